@@ -6,6 +6,9 @@
  */
 
 #include "widgets/status.h"
+#include "display_flush.h"
+#include "widgets/latency.h"
+#include "widgets/profile.h"
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
@@ -19,10 +22,20 @@ lv_obj_t *zmk_display_status_screen() {
     lv_obj_t *screen;
     screen = lv_obj_create(NULL);
 
+    // Set up before the widget, which may already send a frame with the lean renderer
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_LINE_FLUSH)
+    int err = display_flush_init();
+    if (err < 0 && IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_RENDERER_LEAN)) {
+        LOG_ERR("The lean status renderer cannot drive this display (%d)", err);
+    }
+#endif
+
 #if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_STATUS)
     zmk_widget_status_init(&status_widget, screen);
     lv_obj_align(zmk_widget_status_obj(&status_widget), LV_ALIGN_TOP_LEFT, 0, 0);
 #endif
+    latency_init();
+    profile_init();
 
     return screen;
 }
@@ -0,0 +1,263 @@
+/*
+ *
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <string.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/display.h>
+#include <zephyr/kernel.h>
+#include <lvgl.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include "display_flush.h"
+#include "display_lines.h"
+#include "widgets/profile.h"
+#include "widgets/latency.h"
+#include "widgets/mono.h"
+
+// The memory-in-pixel panel is written in whole lines, so an LVGL flush of a
+// rotated canvas strip turns into many lines of which most did not change.
+// This flush keeps a copy of what the panel shows, in the panel's own format,
+// and only sends runs of lines that differ from it. Each run is one
+// display_write, which the driver sends as one multi-line SPI transfer.
+
+#define DISPLAY_NODE DT_CHOSEN(zephyr_display)
+#define DISPLAY_WIDTH DT_PROP(DISPLAY_NODE, width)
+#define DISPLAY_HEIGHT DT_PROP(DISPLAY_NODE, height)
+#define ROW_BYTES DIV_ROUND_UP(DISPLAY_WIDTH, 8)
+
+// LVGL prepends the I1 palette to the rendered pixels
+#define I1_PALETTE_SIZE (LV_COLOR_INDEXED_PALETTE_SIZE(LV_COLOR_FORMAT_I1) * sizeof(lv_color32_t))
+
+static const struct device *display_dev = DEVICE_DT_GET(DISPLAY_NODE);
+
+static uint8_t shadow_rows[DISPLAY_HEIGHT][ROW_BYTES];
+static bool shadow_valid[DISPLAY_HEIGHT];
+static bool shadow_pending[DISPLAY_HEIGHT];
+static struct display_lines shadow = {
+    .rows = &shadow_rows[0][0],
+    .valid = shadow_valid,
+    .pending = shadow_pending,
+    .height = DISPLAY_HEIGHT,
+    .row_bytes = ROW_BYTES,
+};
+static bool invert;
+static struct display_flush_stats stats;
+
+static void write_rows(const uint8_t *rows, int32_t y, int32_t count) {
+    struct display_buffer_descriptor desc = {
+        .buf_size = count * ROW_BYTES,
+        .width = DISPLAY_WIDTH,
+        .height = count,
+        .pitch = DISPLAY_WIDTH,
+    };
+
+    display_write(display_dev, 0, y, &desc, rows);
+
+    stats.writes++;
+    stats.lines += count;
+    stats.bytes += desc.buf_size;
+}
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_ASYNC_FLUSH)
+
+// LVGL's buffer is released as soon as its rows are merged into the shadow.
+// The flush thread then sends from its own copy, so the SPI transfer overlaps
+// with rendering the next frame on the display work queue. Rows changed again
+// while a transfer is running are sent once, with their latest content.
+static K_MUTEX_DEFINE(shadow_lock);
+static K_SEM_DEFINE(flush_sem, 0, 1);
+// Given each time the flush thread has written what was queued
+static K_SEM_DEFINE(written_sem, 0, 1);
+static uint8_t tx_rows[DISPLAY_HEIGHT][ROW_BYTES];
+static bool tx_pending[DISPLAY_HEIGHT];
+static struct display_lines tx = {
+    .rows = &tx_rows[0][0],
+    .pending = tx_pending,
+    .height = DISPLAY_HEIGHT,
+    .row_bytes = ROW_BYTES,
+};
+// Changes queued by flushes and changes written to the panel
+static atomic_t flush_queued;
+static atomic_t flush_written;
+static bool flush_last;
+
+static void flush_thread(void *p1, void *p2, void *p3) {
+    while (true) {
+        k_sem_take(&flush_sem, K_FOREVER);
+
+        k_mutex_lock(&shadow_lock, K_FOREVER);
+        atomic_val_t queued = atomic_get(&flush_queued);
+        bool last = flush_last;
+        flush_last = false;
+        display_lines_take(&tx, &shadow);
+        k_mutex_unlock(&shadow_lock);
+
+        display_lines_send(&tx, write_rows);
+        if (last) {
+            latency_flushed();
+        }
+        atomic_set(&flush_written, queued);
+        k_sem_give(&written_sem);
+    }
+}
+
+K_THREAD_DEFINE(display_flush_thread, CONFIG_NICE_VIEW_WIDGET_FLUSH_THREAD_STACK_SIZE,
+                flush_thread, NULL, NULL, NULL, CONFIG_NICE_VIEW_WIDGET_FLUSH_THREAD_PRIORITY, 0,
+                0);
+
+static void flush_lock(void) { k_mutex_lock(&shadow_lock, K_FOREVER); }
+
+// `last` marks the end of an LVGL refresh, which completes once its rows are sent
+static void flush_unlock(bool changed, bool last) {
+    if (changed || last) {
+        flush_last |= last;
+        atomic_inc(&flush_queued);
+    }
+    k_mutex_unlock(&shadow_lock);
+    if (changed || last) {
+        k_sem_give(&flush_sem);
+    }
+}
+
+// Sleeps until the flush thread has written everything queued so far. A give
+// left over from an earlier pass only costs one more check, as the thread gives
+// again once it has caught up with what is still queued. Only the display work
+// queue waits here.
+void display_flush_sync(void) {
+    while (atomic_get(&flush_written) != atomic_get(&flush_queued)) {
+        k_sem_take(&written_sem, K_FOREVER);
+    }
+}
+
+#else
+
+static void flush_lock(void) {}
+
+static void flush_unlock(bool changed, bool last) {
+    if (changed) {
+        display_lines_send(&shadow, write_rows);
+    }
+    if (last) {
+        latency_flushed();
+    }
+}
+
+void display_flush_sync(void) {}
+
+#endif /* IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_ASYNC_FLUSH) */
+
+// The canvases are packed 1 bpp already, but LVGL composes them into its own
+// I1 buffer, so what arrives here is that buffer and not a canvas. Its rows
+// still need two steps before they match the panel:
+//  - The panel is written in whole lines, while LVGL flushes the invalidated
+//    area only. Its rows start at bit 0 of the area, and the middle and bottom
+//    canvases sit at columns 58 and 130, which are not byte aligned. So each
+//    row is shifted into a copy of the full panel line. Byte-aligned areas are
+//    a straight word copy in mono_blit_row().
+//  - LVGL sets I1 bits for light pixels. MONO10 panels expect set bits for
+//    dark pixels, so their rows are inverted. MONO01 panels are not.
+// Both work on the changed rows only, a word at a time.
+static void flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map) {
+    const profile_time_t start = profile_start();
+    const int32_t w = lv_area_get_width(area);
+    const uint32_t stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_I1);
+    const uint8_t *src = px_map + I1_PALETTE_SIZE;
+    bool changed = false;
+    uint8_t row[ROW_BYTES];
+
+    flush_lock();
+    for (int32_t y = area->y1; y <= area->y2; y++, src += stride) {
+        memcpy(row, shadow_rows[y], ROW_BYTES);
+        display_lines_merge(row, src, area->x1, w, invert);
+        changed |= display_lines_update(&shadow, y, row);
+    }
+    flush_unlock(changed, lv_display_flush_is_last(disp));
+
+    profile_stop(PROFILE_FLUSH, start);
+    lv_display_flush_ready(disp);
+}
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_RENDERER_LEAN)
+static bool frame_ready;
+
+// The lean renderer owns the panel. LVGL still refreshes its empty screen,
+// which is dropped here so it never overwrites the status frame.
+static void discard_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map) {
+    lv_display_flush_ready(disp);
+}
+
+void display_flush_frame(const uint8_t *rows, uint32_t stride, int32_t y1, int32_t y2) {
+    const profile_time_t start = profile_start();
+    bool changed = false;
+    uint8_t row[ROW_BYTES];
+
+    if (!frame_ready) {
+        return;
+    }
+
+    flush_lock();
+    for (int32_t y = y1; y <= y2; y++) {
+        memcpy(row, rows + y * stride, ROW_BYTES);
+        if (invert) {
+            mono_invert_span(row, 0, DISPLAY_WIDTH);
+        }
+        changed |= display_lines_update(&shadow, y, row);
+    }
+    flush_unlock(changed, true);
+
+    profile_stop(PROFILE_FLUSH, start);
+}
+#endif /* IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_RENDERER_LEAN) */
+
+int display_flush_init(void) {
+    lv_display_t *disp = lv_display_get_default();
+    struct display_capabilities caps;
+
+    if (disp == NULL || !device_is_ready(display_dev)) {
+        return -ENODEV;
+    }
+
+    display_get_capabilities(display_dev, &caps);
+
+    // Only horizontally packed, MSB-first panels match LVGL's I1 rows; anything
+    // else keeps the default Zephyr flush and its conversion
+    if (caps.x_resolution != DISPLAY_WIDTH || caps.y_resolution != DISPLAY_HEIGHT ||
+        (caps.screen_info & SCREEN_INFO_MONO_VTILED) ||
+        !(caps.screen_info & SCREEN_INFO_MONO_MSB_FIRST) ||
+        lv_display_get_color_format(disp) != LV_COLOR_FORMAT_I1) {
+        LOG_WRN("Line flush not supported by the display, using the default flush");
+        return -ENOTSUP;
+    }
+
+    // LVGL sets I1 bits for light pixels, MONO10 panels expect them for dark ones
+    switch (caps.current_pixel_format) {
+    case PIXEL_FORMAT_MONO01:
+        invert = false;
+        break;
+    case PIXEL_FORMAT_MONO10:
+        invert = true;
+        break;
+    default:
+        LOG_WRN("Line flush not supported by the display, using the default flush");
+        return -ENOTSUP;
+    }
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_RENDERER_LEAN)
+    lv_display_set_flush_cb(disp, discard_cb);
+    frame_ready = true;
+#else
+    lv_display_set_flush_cb(disp, flush_cb);
+#endif
+
+    return 0;
+}
+
+void display_flush_get_stats(struct display_flush_stats *out) { *out = stats; }
+
+void display_flush_reset_stats(void) { memset(&stats, 0, sizeof(stats)); }
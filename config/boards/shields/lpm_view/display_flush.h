@@ -0,0 +1,24 @@
+/*
+ *
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+struct display_flush_stats {
+    uint32_t writes;
+    uint32_t lines;
+    uint32_t bytes;
+};
+
+int display_flush_init(void);
+void display_flush_sync(void);
+// Sends rows `y1` to `y2` of a packed 1 bpp frame in panel orientation, with set
+// bits for light pixels. Only used by the lean renderer.
+void display_flush_frame(const uint8_t *rows, uint32_t stride, int32_t y1, int32_t y2);
+void display_flush_get_stats(struct display_flush_stats *stats);
+void display_flush_reset_stats(void);
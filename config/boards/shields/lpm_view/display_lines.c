@@ -0,0 +1,64 @@
+/*
+ *
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <string.h>
+
+#include "display_lines.h"
+#include "widgets/mono.h"
+
+static inline uint8_t *row_ptr(const struct display_lines *lines, int32_t y) {
+    return lines->rows + y * lines->row_bytes;
+}
+
+void display_lines_merge(uint8_t *dst, const uint8_t *src, int32_t x1, int32_t w, bool invert) {
+    mono_blit_row(dst, x1, src, 0, w, MONO_OP_COPY);
+    if (invert) {
+        mono_invert_span(dst, x1, w);
+    }
+}
+
+bool display_lines_update(struct display_lines *lines, int32_t y, const uint8_t *row) {
+    uint8_t *dst = row_ptr(lines, y);
+    const bool valid = lines->valid == NULL || lines->valid[y];
+
+    if (valid && memcmp(row, dst, lines->row_bytes) == 0) {
+        return false;
+    }
+
+    memcpy(dst, row, lines->row_bytes);
+    if (lines->valid != NULL) {
+        lines->valid[y] = true;
+    }
+    lines->pending[y] = true;
+    return true;
+}
+
+void display_lines_send(struct display_lines *lines, display_lines_write_cb write) {
+    int32_t run = -1;
+
+    for (int32_t y = 0; y <= lines->height; y++) {
+        if (y < lines->height && lines->pending[y]) {
+            lines->pending[y] = false;
+            if (run < 0) {
+                run = y;
+            }
+        } else if (run >= 0) {
+            write(row_ptr(lines, run), run, y - run);
+            run = -1;
+        }
+    }
+}
+
+void display_lines_take(struct display_lines *dst, struct display_lines *src) {
+    for (int32_t y = 0; y < src->height; y++) {
+        if (src->pending[y]) {
+            memcpy(row_ptr(dst, y), row_ptr(src, y), src->row_bytes);
+            dst->pending[y] = true;
+            src->pending[y] = false;
+        }
+    }
+}
@@ -0,0 +1,40 @@
+/*
+ *
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Line bookkeeping for the line flush: which rows of a packed 1 bpp frame differ
+// from what the panel shows, and the runs of them to send. Kept apart from the
+// LVGL and display driver glue in display_flush.c so it can be tested on the
+// host.
+
+struct display_lines {
+    // `height` rows of `row_bytes` each
+    uint8_t *rows;
+    // Rows whose content is known; NULL if every row is
+    bool *valid;
+    // Rows changed since they were last sent
+    bool *pending;
+    int32_t height;
+    uint32_t row_bytes;
+};
+
+// Sends `count` rows starting at row `y`, which `rows` points to
+typedef void (*display_lines_write_cb)(const uint8_t *rows, int32_t y, int32_t count);
+
+// Merges `w` pixels from the start of `src` into `dst` at pixel `x1`, inverting
+// them if `invert` is set
+void display_lines_merge(uint8_t *dst, const uint8_t *src, int32_t x1, int32_t w, bool invert);
+// Stores the new content of row `y`. Returns true if it changed and is pending.
+bool display_lines_update(struct display_lines *lines, int32_t y, const uint8_t *row);
+// Writes every run of consecutive pending rows with one call and clears them
+void display_lines_send(struct display_lines *lines, display_lines_write_cb write);
+// Copies the pending rows of `src` into `dst` and moves them to its pending rows
+void display_lines_take(struct display_lines *dst, struct display_lines *src);
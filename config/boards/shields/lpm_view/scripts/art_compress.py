@@ -0,0 +1,212 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2025 The ZMK Contributors
+# SPDX-License-Identifier: MIT
+#
+"""Converts PNG artwork into compressed 1 bpp images for the art decoder.
+
+Pixels are thresholded to black and white; white pixels are stored as 1. Each
+row starts with a 3-bit predictor that guesses it from the rows above:
+
+  0  nothing (all zero)
+  1  the row above
+  2  the row two above
+  3  the row above, shifted right by one pixel
+  4  the row above, shifted left by one pixel
+
+followed by the pixels that differ from the guess, as Elias gamma coded
+distances: a code n skips n - 1 matching pixels and flips the next one, unless
+that reaches the end of the row. Bits are packed MSB first. The decoder only
+needs the two previous rows, so images decode row by row.
+"""
+
+import argparse
+import pathlib
+import re
+import struct
+import sys
+import zlib
+
+PREDICTORS = 5
+
+
+def read_png(path):
+    data = path.read_bytes()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        sys.exit(f"{path}: not a PNG file")
+
+    pos = 8
+    idat = b""
+    palette = None
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos : pos + 8])
+        body = data[pos + 8 : pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            width, height, depth, color, _, _, interlace = struct.unpack(">IIBBBBB", body)
+        elif kind == b"PLTE":
+            palette = [tuple(body[i : i + 3]) for i in range(0, len(body), 3)]
+        elif kind == b"IDAT":
+            idat += body
+        elif kind == b"IEND":
+            break
+
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}.get(color)
+    if channels is None or interlace or (depth != 8 and color not in (0, 3)) or depth > 8:
+        sys.exit(f"{path}: unsupported PNG format (color type {color}, depth {depth})")
+
+    stride = (width * channels * depth + 7) // 8
+    step = max(1, channels * depth // 8)
+    raw = zlib.decompress(idat)
+    rows = []
+    prev = bytearray(stride)
+    for y in range(height):
+        kind = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1 : (y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = line[i - step] if i >= step else 0
+            b = prev[i]
+            c = prev[i - step] if i >= step else 0
+            if kind == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif kind == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif kind == 3:
+                line[i] = (line[i] + (a + b) // 2) & 0xFF
+            elif kind == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                line[i] = (line[i] + (a if pa <= pb and pa <= pc else b if pb <= pc else c)) & 0xFF
+        rows.append(line)
+        prev = line
+
+    def sample(line, index):
+        if depth == 8:
+            return line[index]
+        bit = index * depth
+        return (line[bit // 8] >> (8 - depth - bit % 8)) & ((1 << depth) - 1)
+
+    pixels = []
+    for line in rows:
+        row = []
+        for x in range(width):
+            if color == 3:
+                r, g, b = palette[sample(line, x)]
+            elif color in (0, 4):
+                r = g = b = sample(line, x * channels) * 255 // ((1 << depth) - 1)
+            else:
+                r, g, b = line[x * channels : x * channels + 3]
+            row.append(1 if r * 299 + g * 587 + b * 114 >= 128000 else 0)
+        pixels.append(row)
+
+    return width, height, pixels
+
+
+def predict(pixels, y, kind):
+    width = len(pixels[y])
+    up = pixels[y - 1] if y >= 1 else [0] * width
+    if kind == 1:
+        return up
+    if kind == 2:
+        return pixels[y - 2] if y >= 2 else [0] * width
+    if kind == 3:
+        return [0] + up[:-1]
+    if kind == 4:
+        return up[1:] + [0]
+    return [0] * width
+
+
+def gamma(n):
+    return "0" * (n.bit_length() - 1) + bin(n)[2:]
+
+
+def encode_row(row, guess):
+    bits = ""
+    x = 0
+    for i, (pixel, guessed) in enumerate(zip(row, guess)):
+        if pixel != guessed:
+            bits += gamma(i - x + 1)
+            x = i + 1
+    if x < len(row):
+        bits += gamma(len(row) - x + 1)
+    return bits
+
+
+def compress(width, height, pixels):
+    bits = ""
+    for y in range(height):
+        rows = [encode_row(pixels[y], predict(pixels, y, k)) for k in range(PREDICTORS)]
+        kind = min(range(PREDICTORS), key=lambda k: len(rows[k]))
+        bits += format(kind, "03b") + rows[kind]
+    bits += "0" * (-len(bits) % 8)
+    return bytes(int(bits[i : i + 8], 2) for i in range(0, len(bits), 8))
+
+
+def write_pbm(path, width, height, pixels):
+    # PBM stores black as 1, the opposite of the compressed format
+    body = bytearray()
+    for row in pixels:
+        bits = "".join("0" if pixel else "1" for pixel in row)
+        bits += "0" * (-len(bits) % 8)
+        body += bytes(int(bits[i : i + 8], 2) for i in range(0, len(bits), 8))
+
+    path.parent.mkdir(parents=True, exist_ok=True)
+    path.write_bytes(f"P4\n{width} {height}\n".encode() + body)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--output", required=True, type=pathlib.Path)
+    parser.add_argument(
+        "--pbm-dir",
+        type=pathlib.Path,
+        help="also write the thresholded images as binary PBM files, to check the decoder against",
+    )
+    parser.add_argument("images", nargs="+", type=pathlib.Path)
+    args = parser.parse_args()
+
+    out = [
+        "/*",
+        " * Generated by scripts/art_compress.py from the widgets/art images, do not edit.",
+        " */",
+        "",
+        '#include "art.h"',
+        "",
+    ]
+    names = []
+    for path in sorted(args.images):
+        name = re.sub(r"\W", "_", path.stem)
+        width, height, pixels = read_png(path)
+        data = compress(width, height, pixels)
+        names.append(name)
+        if args.pbm_dir:
+            write_pbm(args.pbm_dir / f"{name}.pbm", width, height, pixels)
+        out += [f"// {path.name}: {len(data)} bytes, {(width + 7) // 8 * height} uncompressed"]
+        out += [f"static const uint8_t art_{name}_data[] = {{"]
+        for i in range(0, len(data), 15):
+            out.append("    " + " ".join(f"0x{b:02x}," for b in data[i : i + 15]))
+        out += [
+            "};",
+            "",
+            f"static const lv_image_dsc_t art_{name} = {{",
+            "    .header.magic = LV_IMAGE_HEADER_MAGIC,",
+            "    .header.cf = LV_COLOR_FORMAT_L8,",
+            "    .header.flags = ART_IMAGE_FLAG,",
+            f"    .header.w = {width},",
+            f"    .header.h = {height},",
+            f"    .data_size = sizeof(art_{name}_data),",
+            f"    .data = art_{name}_data,",
+            "};",
+            "",
+        ]
+
+    out.append("const lv_image_dsc_t *const art_images[] = {")
+    out += [f"    &art_{name}," for name in names]
+    out += ["};", "", "const size_t art_image_count = ARRAY_SIZE(art_images);", ""]
+
+    args.output.parent.mkdir(parents=True, exist_ok=True)
+    args.output.write_text("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
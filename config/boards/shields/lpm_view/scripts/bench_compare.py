@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2025 The ZMK Contributors
+# SPDX-License-Identifier: MIT
+#
+"""Compares two captures of the NICE_VIEW_WIDGET_BENCH output.
+
+Reads the lpm_bench CSV records from two console logs, for example of the
+parent commit and of a change, prints every metric that moved and exits with
+status 1 if any got worse by more than the threshold. Time metrics below the
+noise floor in both captures are ignored.
+"""
+
+import argparse
+import pathlib
+import sys
+
+# Record kind: (key fields, metric fields, metrics that must not grow)
+RECORDS = {
+    "slot": (("script", "slot"), ("calls", "total_us", "max_us"), ("total_us",)),
+    "total": (
+        ("script",),
+        ("frames", "bytes", "lines", "written"),
+        ("frames", "lines", "written"),
+    ),
+}
+TIME_METRICS = ("total_us", "max_us")
+
+
+def read_capture(path):
+    metrics = {}
+
+    for number, line in enumerate(path.read_text(errors="replace").splitlines(), 1):
+        start = line.find("lpm_bench,")
+        if start < 0:
+            continue
+        fields = line[start:].strip().split(",")
+        kind = fields[1] if len(fields) > 1 else None
+        if kind not in RECORDS:
+            sys.exit(f"{path}:{number}: unknown lpm_bench record {kind!r}")
+        keys, names, _ = RECORDS[kind]
+        if len(fields) != 2 + len(keys) + len(names):
+            sys.exit(f"{path}:{number}: malformed lpm_bench {kind} record")
+        key = (kind,) + tuple(fields[2 : 2 + len(keys)])
+        try:
+            values = [int(value) for value in fields[2 + len(keys) :]]
+        except ValueError:
+            sys.exit(f"{path}:{number}: malformed lpm_bench {kind} record")
+        metrics[key] = dict(zip(names, values))
+
+    if not metrics:
+        sys.exit(f"{path}: no lpm_bench records")
+    return metrics
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("base", type=pathlib.Path)
+    parser.add_argument("head", type=pathlib.Path)
+    parser.add_argument(
+        "--threshold", type=float, default=10.0, help="allowed growth in percent (default 10)"
+    )
+    parser.add_argument(
+        "--noise-us", type=int, default=50, help="time metrics below this are noise (default 50)"
+    )
+    args = parser.parse_args()
+
+    base = read_capture(args.base)
+    head = read_capture(args.head)
+    regressions = 0
+
+    for key in sorted(base.keys() | head.keys()):
+        name = ",".join(key)
+        if key not in head or key not in base:
+            print(f"{name}: only in {'base' if key in base else 'head'}")
+            continue
+
+        _, _, guarded = RECORDS[key[0]]
+        for metric, old in base[key].items():
+            new = head[key][metric]
+            if new == old:
+                continue
+            if metric in TIME_METRICS and max(old, new) < args.noise_us:
+                continue
+
+            change = (new - old) * 100.0 / old if old else float("inf")
+            worse = metric in guarded and change > args.threshold
+            regressions += worse
+            flag = " REGRESSION" if worse else ""
+            print(f"{name},{metric}: {old} -> {new} ({change:+.1f}%){flag}")
+
+    print(f"{regressions} regressions")
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,119 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2025 The ZMK Contributors
+# SPDX-License-Identifier: MIT
+#
+"""Generates LVGL fonts holding only the glyphs the lpm_view widgets can draw.
+
+Each font gets the characters and LV_SYMBOL_* glyphs listed for it in CHARSETS,
+plus the layer names in the keymap for the font that draws them. The drawing
+sources are only checked for LV_SYMBOL_* glyphs missing from the lists.
+"""
+
+import argparse
+import pathlib
+import re
+import subprocess
+import sys
+
+SYMBOL_USE = re.compile(r"\bLV_SYMBOL_(\w+)")
+SYMBOL_DEF = re.compile(r'#define\s+LV_SYMBOL_(\w+)\s+"[^"]*"\s*/\*\s*(\d+)')
+LAYER_NAME = re.compile(r'\b(?:display-name|label)\s*=\s*"([^"]*)"')
+
+DIGITS = "0123456789"
+
+# What each font draws; keep in step with the widgets. Text is formatted at
+# runtime, so it is listed here rather than collected from string literals.
+CHARSETS = {
+    # Layer name, or "LAYER n" and its digit atlas
+    "montserrat_14": {"text": "LAYER " + DIGITS, "layer_names": True},
+    # Output status. The space keeps the Montserrat line metrics the symbols
+    # are placed by.
+    "montserrat_16": {"text": " ", "symbols": ("USB", "WIFI", "CLOSE", "SETTINGS")},
+    # Profile numbers
+    "montserrat_18": {"text": DIGITS},
+    # WPM number and its digit atlas
+    "unscii_8": {"text": DIGITS},
+}
+
+
+def source_symbols(path):
+    return set(SYMBOL_USE.findall(path.read_text(encoding="utf-8")))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--lv-font-conv", required=True)
+    parser.add_argument("--font-dir", required=True, type=pathlib.Path)
+    parser.add_argument("--symbol-def", required=True, type=pathlib.Path)
+    parser.add_argument("--symbol-font", required=True)
+    parser.add_argument("--output-dir", required=True, type=pathlib.Path)
+    parser.add_argument("--source", action="append", default=[], type=pathlib.Path)
+    parser.add_argument("--keymap", action="append", default=[], type=pathlib.Path)
+    parser.add_argument(
+        "--font",
+        action="append",
+        required=True,
+        help="name:file:size:bpp, for example montserrat_16:Montserrat-Medium.ttf:16:4",
+    )
+    args = parser.parse_args()
+
+    symbol_codes = {
+        name: int(code)
+        for name, code in SYMBOL_DEF.findall(args.symbol_def.read_text(encoding="utf-8"))
+    }
+
+    listed = {name for charset in CHARSETS.values() for name in charset.get("symbols", ())}
+    for source in args.source:
+        missing = source_symbols(source) - listed
+        if missing:
+            sys.exit(f"{source}: LV_SYMBOL_{min(missing)} is in no font of CHARSETS")
+    unknown = listed - symbol_codes.keys()
+    if unknown:
+        sys.exit(f"{args.symbol_def}: unknown symbol LV_SYMBOL_{min(unknown)}")
+
+    layer_names = set()
+    for keymap in args.keymap:
+        for name in LAYER_NAME.findall(keymap.read_text(encoding="utf-8")):
+            layer_names.update(name)
+
+    args.output_dir.mkdir(parents=True, exist_ok=True)
+
+    for spec in args.font:
+        name, file, size, bpp = spec.split(":")
+        if name not in CHARSETS:
+            sys.exit(f"no charset for font {name}")
+        charset = CHARSETS[name]
+
+        chars = set(charset.get("text", ""))
+        if charset.get("layer_names"):
+            chars |= layer_names
+        text = "".join(sorted(c for c in chars if c.isprintable()))
+        symbols = sorted(symbol_codes[symbol] for symbol in charset.get("symbols", ()))
+
+        command = [
+            args.lv_font_conv,
+            "--no-compress",
+            "--no-prefilter",
+            "--force-fast-kern-format",
+            "--format", "lvgl",
+            "--lv-include", "lvgl.h",
+            "--bpp", bpp,
+            "--size", size,
+            "--font", str(args.font_dir / file),
+            "--symbols", text,
+        ]
+        if symbols:
+            command += [
+                "--font", str(args.font_dir / args.symbol_font),
+                "--range", ",".join(hex(code) for code in symbols),
+            ]
+        command += [
+            "--lv-font-name", f"lpm_font_{name}",
+            "-o", str(args.output_dir / f"lpm_font_{name}.c"),
+        ]
+        subprocess.run(command, check=True)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,56 @@
+/*
+ *
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "art.h"
+#include "art_stream.h"
+
+// Times decoding each generated image in full. Prints one
+// "index compressed_bytes raw_bytes ns_per_image" line per image.
+//
+// Usage: art_bench [iterations]
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+int main(int argc, char **argv) {
+    const int iterations = argc > 1 ? atoi(argv[1]) : 10000;
+    uint8_t rows[ART_STREAM_ROWS_SIZE(UINT16_MAX)];
+
+    for (size_t i = 0; i < art_image_count; i++) {
+        const lv_image_dsc_t *img = art_images[i];
+        struct art_stream s;
+        int res = 0;
+
+        art_stream_init(&s, img->data, img->data_size, img->header.w, rows);
+        const uint64_t start = now_ns();
+        for (int n = 0; n < iterations; n++) {
+            art_stream_reset(&s);
+            for (int y = 0; y < img->header.h; y++) {
+                res |= art_stream_decode_row(&s);
+            }
+        }
+        const uint64_t elapsed = (now_ns() - start) / iterations;
+
+        if (res != 0) {
+            printf("%zu corrupt\n", i);
+            return 1;
+        }
+        printf("%zu %u %u %llu\n", i, img->data_size, (img->header.w + 7) / 8 * img->header.h,
+               (unsigned long long)elapsed);
+    }
+
+    return 0;
+}
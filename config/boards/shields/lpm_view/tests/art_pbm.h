@@ -0,0 +1,47 @@
+/*
+ *
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Reads the binary PBM files scripts/art_compress.py writes with --pbm-dir,
+// flipping them back so set bits are white as in the compressed format
+static inline uint8_t *art_pbm_read(const char *path, int *width, int *height) {
+    FILE *f = fopen(path, "rb");
+    uint8_t *pixels = NULL;
+
+    if (f == NULL || fscanf(f, "P4 %d %d", width, height) != 2 || fgetc(f) == EOF) {
+        goto out;
+    }
+
+    const size_t size = (size_t)(*width + 7) / 8 * *height;
+    pixels = malloc(size);
+    if (pixels == NULL || fread(pixels, 1, size, f) != size) {
+        free(pixels);
+        pixels = NULL;
+        goto out;
+    }
+
+    for (size_t i = 0; i < size; i++) {
+        pixels[i] = ~pixels[i];
+    }
+    // Clear the padding, which the decoder keeps clear
+    if (*width % 8 != 0) {
+        for (int y = 0; y < *height; y++) {
+            pixels[(y + 1) * ((*width + 7) / 8) - 1] &= 0xff << (8 - *width % 8);
+        }
+    }
+
+out:
+    if (f != NULL) {
+        fclose(f);
+    }
+    return pixels;
+}
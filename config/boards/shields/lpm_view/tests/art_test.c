@@ -0,0 +1,86 @@
+/*
+ *
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "art.h"
+#include "art_pbm.h"
+#include "art_stream.h"
+
+// Decodes every image scripts/art_compress.py generated from widgets/art and
+// compares it with the thresholded source the script wrote alongside, then
+// checks that the decoder stops cleanly on truncated data.
+//
+// Usage: art_test <pbm>... in the order of art_images[]
+
+static int failures;
+
+static void fail(const char *what, size_t image, int row) {
+    if (failures++ < 10) {
+        printf("FAIL %s image=%zu row=%d\n", what, image, row);
+    }
+}
+
+static void check_image(size_t index, const char *pbm) {
+    const lv_image_dsc_t *img = art_images[index];
+    int width, height;
+    uint8_t *want = art_pbm_read(pbm, &width, &height);
+
+    if (want == NULL || width != img->header.w || height != img->header.h) {
+        fail(pbm, index, -1);
+        free(want);
+        return;
+    }
+
+    const int stride = (width + 7) / 8;
+    uint8_t rows[ART_STREAM_ROWS_SIZE(UINT16_MAX)];
+    struct art_stream s;
+
+    // Twice, the second time after a rewind as when LVGL redraws the image
+    art_stream_init(&s, img->data, img->data_size, width, rows);
+    for (int pass = 0; pass < 2; pass++) {
+        for (int y = 0; y < height; y++) {
+            if (art_stream_decode_row(&s) != 0 || memcmp(s.cur, want + y * stride, stride) != 0) {
+                fail("decode", index, y);
+                break;
+            }
+        }
+        art_stream_reset(&s);
+    }
+
+    // The last byte always holds data, so any truncation must be reported
+    for (uint32_t size = 0; size < img->data_size; size++) {
+        int res = 0;
+
+        art_stream_init(&s, img->data, size, width, rows);
+        for (int y = 0; y < height && res == 0; y++) {
+            res = art_stream_decode_row(&s);
+        }
+        if (res != -EINVAL) {
+            fail("truncated", index, size);
+        }
+    }
+
+    free(want);
+}
+
+int main(int argc, char **argv) {
+    if ((size_t)argc - 1 != art_image_count) {
+        printf("FAIL expected %zu images, got %d\n", art_image_count, argc - 1);
+        return 1;
+    }
+
+    for (size_t i = 0; i < art_image_count; i++) {
+        check_image(i, argv[i + 1]);
+    }
+
+    printf("art_test: %zu images, %d failures\n", art_image_count, failures);
+    return failures == 0 ? 0 : 1;
+}
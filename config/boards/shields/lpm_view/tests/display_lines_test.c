@@ -0,0 +1,140 @@
+/*
+ *
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "display_lines.h"
+#include "ref.h"
+
+// Feeds LVGL-style flushes of the status screen through the line flush
+// bookkeeping into a mock display that counts writes, lines and bytes, and
+// checks that only changed lines are written, in one write per run, and that
+// the mock panel ends up showing the frame.
+
+#define WIDTH 144
+#define HEIGHT 72
+#define ROW_BYTES (WIDTH / 8)
+
+static uint8_t shadow_rows[HEIGHT][ROW_BYTES];
+static bool shadow_valid[HEIGHT];
+static bool shadow_pending[HEIGHT];
+static struct display_lines shadow = {
+    .rows = &shadow_rows[0][0],
+    .valid = shadow_valid,
+    .pending = shadow_pending,
+    .height = HEIGHT,
+    .row_bytes = ROW_BYTES,
+};
+
+// What the mock display received
+static uint8_t panel[HEIGHT][ROW_BYTES];
+static struct {
+    uint32_t writes;
+    uint32_t lines;
+    uint32_t bytes;
+} sent;
+
+// The frame LVGL renders, in LVGL's I1 format with set bits for light pixels
+static uint8_t frame[HEIGHT][ROW_BYTES];
+
+static int failures;
+
+static void mock_write(const uint8_t *rows, int32_t y, int32_t count) {
+    memcpy(panel[y], rows, count * ROW_BYTES);
+    sent.writes++;
+    sent.lines += count;
+    sent.bytes += count * ROW_BYTES;
+}
+
+// What flush_cb does with one flushed area: cut the area out of the frame as
+// LVGL would hand it over, merge it into the shadow and send the changes
+static void flush(int32_t x1, int32_t y1, int32_t x2, int32_t y2, bool invert) {
+    const int32_t w = x2 - x1 + 1;
+    uint8_t area[ROW_BYTES], row[ROW_BYTES];
+
+    memset(&sent, 0, sizeof(sent));
+    for (int32_t y = y1; y <= y2; y++) {
+        memset(area, 0, sizeof(area));
+        ref_blit_row(area, 0, frame[y], x1, w, MONO_OP_COPY);
+        memcpy(row, shadow_rows[y], ROW_BYTES);
+        display_lines_merge(row, area, x1, w, invert);
+        display_lines_update(&shadow, y, row);
+    }
+    display_lines_send(&shadow, mock_write);
+}
+
+static void expect(const char *what, uint32_t writes, uint32_t lines, bool invert) {
+    bool shows_frame = true;
+
+    for (int32_t y = 0; y < HEIGHT; y++) {
+        for (int32_t x = 0; x < WIDTH; x++) {
+            shows_frame &= ref_get(panel[y], x) == (ref_get(frame[y], x) != invert);
+        }
+    }
+
+    if (sent.writes != writes || sent.lines != lines || sent.bytes != lines * ROW_BYTES ||
+        !shows_frame) {
+        failures++;
+        printf("FAIL %s: %u writes, %u lines, %u bytes, %s\n", what, sent.writes, sent.lines,
+               sent.bytes, shows_frame ? "shows the frame" : "does not show the frame");
+    }
+}
+
+// Sets a logical pixel of the middle canvas, which is rotated onto panel
+// columns 58 to 125
+static void set_middle(int32_t x, int32_t y, bool set) { ref_put(frame[67 - x], 58 + y, set); }
+
+static void run(bool invert) {
+    memset(shadow_valid, 0, sizeof(shadow_valid));
+    for (size_t i = 0; i < sizeof(frame); i++) {
+        (&frame[0][0])[i] = (uint8_t)ref_random();
+    }
+
+    // Nothing is known about the panel, so the first frame is sent in full
+    flush(0, 0, WIDTH - 1, HEIGHT - 1, invert);
+    expect("first frame", 1, HEIGHT, invert);
+
+    flush(0, 0, WIDTH - 1, HEIGHT - 1, invert);
+    expect("unchanged frame", 0, 0, invert);
+
+    // A battery bar step: two adjacent logical columns of a canvas are two
+    // panel rows, while LVGL flushes the whole rotated canvas strip
+    set_middle(10, 3, !ref_get(frame[67 - 10], 58 + 3));
+    set_middle(11, 3, !ref_get(frame[67 - 11], 58 + 3));
+    flush(58, 0, 125, 67, invert);
+    expect("adjacent lines", 1, 2, invert);
+
+    // Two separate changes are two runs
+    set_middle(0, 0, !ref_get(frame[67], 58));
+    set_middle(40, 60, !ref_get(frame[27], 58 + 60));
+    flush(58, 0, 125, 67, invert);
+    expect("separate lines", 2, 2, invert);
+
+    // A change undone before it is flushed is not sent
+    set_middle(20, 20, !ref_get(frame[47], 78));
+    set_middle(20, 20, !ref_get(frame[47], 78));
+    flush(58, 0, 125, 67, invert);
+    expect("undone change", 0, 0, invert);
+
+    // Areas that do not start or end on a byte keep the pixels around them
+    for (int32_t y = 5; y < 9; y++) {
+        ref_invert_span(frame[y], 3, 13);
+    }
+    flush(3, 5, 15, 8, invert);
+    expect("unaligned area", 1, 4, invert);
+}
+
+int main(void) {
+    run(false);
+    run(true);
+
+    printf("display_lines_test: %d failures\n", failures);
+    return failures == 0 ? 0 : 1;
+}
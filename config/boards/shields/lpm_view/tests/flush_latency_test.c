@@ -0,0 +1,218 @@
+/*
+ *
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "display_lines.h"
+#include "ref.h"
+
+// Renders a stream of frames into the line flush while a mock SPI device takes
+// a fixed time per line, once sending from the rendering thread as the
+// synchronous flush does, and once from a flush thread that mirrors the one in
+// display_flush.c with pthreads. Checks that the panel ends up showing the last
+// frame in both cases, and that sending in the background overlaps the
+// transfers with rendering.
+//
+// Usage: flush_latency_test [frames]
+
+#define WIDTH 144
+#define HEIGHT 72
+#define ROW_BYTES (WIDTH / 8)
+
+// A 4 MHz SPI clock sends a line with its address and trailer in about 40 us
+#define LINE_US 40
+// Rendering a frame that redraws the WPM graph
+#define RENDER_US 2000
+// Panel rows the graph covers
+#define CHANGED_ROWS 20
+
+static uint8_t shadow_rows[HEIGHT][ROW_BYTES];
+static bool shadow_valid[HEIGHT];
+static bool shadow_pending[HEIGHT];
+static struct display_lines shadow = {
+    .rows = &shadow_rows[0][0],
+    .valid = shadow_valid,
+    .pending = shadow_pending,
+    .height = HEIGHT,
+    .row_bytes = ROW_BYTES,
+};
+
+static uint8_t tx_rows[HEIGHT][ROW_BYTES];
+static bool tx_pending[HEIGHT];
+static struct display_lines tx = {
+    .rows = &tx_rows[0][0],
+    .pending = tx_pending,
+    .height = HEIGHT,
+    .row_bytes = ROW_BYTES,
+};
+
+static uint8_t frame[HEIGHT][ROW_BYTES];
+static uint8_t panel[HEIGHT][ROW_BYTES];
+static uint32_t lines_sent;
+
+static pthread_mutex_t shadow_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t flush_cond = PTHREAD_COND_INITIALIZER;
+// The k_sem with a limit of one, and the queued and written counts
+static bool flush_signalled;
+static uint32_t flush_queued;
+static uint32_t flush_written;
+static bool flush_stop;
+
+static uint64_t now_us(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000u + ts.tv_nsec / 1000;
+}
+
+static void busy_wait_us(uint64_t us) {
+    const uint64_t end = now_us() + us;
+
+    while (now_us() < end) {
+    }
+}
+
+static void sleep_us(uint64_t us) {
+    struct timespec ts = {.tv_sec = us / 1000000, .tv_nsec = (us % 1000000) * 1000};
+
+    nanosleep(&ts, NULL);
+}
+
+static void mock_spi_write(const uint8_t *rows, int32_t y, int32_t count) {
+    sleep_us((uint64_t)count * LINE_US);
+    memcpy(panel[y], rows, count * ROW_BYTES);
+    lines_sent += count;
+}
+
+// Renders frame `n`, changing the graph rows. Rendering keeps the CPU busy,
+// sending only waits for the SPI transfer.
+static void render_frame(int n) {
+    busy_wait_us(RENDER_US);
+    for (int32_t y = 0; y < CHANGED_ROWS; y++) {
+        frame[y][n % ROW_BYTES] ^= (uint8_t)(1 + ref_random() % 255);
+    }
+}
+
+// What flush_cb does with the rendered frame
+static bool flush_frame(void) {
+    bool changed = false;
+
+    for (int32_t y = 0; y < HEIGHT; y++) {
+        changed |= display_lines_update(&shadow, y, frame[y]);
+    }
+    return changed;
+}
+
+static void *flush_thread(void *arg) {
+    pthread_mutex_lock(&shadow_lock);
+    while (true) {
+        while (!flush_signalled && !flush_stop) {
+            pthread_cond_wait(&flush_cond, &shadow_lock);
+        }
+        if (flush_stop) {
+            break;
+        }
+        flush_signalled = false;
+        const uint32_t queued = flush_queued;
+        display_lines_take(&tx, &shadow);
+        pthread_mutex_unlock(&shadow_lock);
+
+        display_lines_send(&tx, mock_spi_write);
+
+        pthread_mutex_lock(&shadow_lock);
+        flush_written = queued;
+        pthread_cond_broadcast(&flush_cond);
+    }
+    pthread_mutex_unlock(&shadow_lock);
+    return NULL;
+}
+
+static void reset(void) {
+    memset(frame, 0, sizeof(frame));
+    memset(panel, 0, sizeof(panel));
+    memset(shadow_valid, 0, sizeof(shadow_valid));
+    memset(shadow_pending, 0, sizeof(shadow_pending));
+    memset(tx_pending, 0, sizeof(tx_pending));
+    lines_sent = 0;
+    flush_queued = flush_written = 0;
+    flush_signalled = flush_stop = false;
+}
+
+static uint64_t run_sync(int frames) {
+    reset();
+    const uint64_t start = now_us();
+
+    for (int n = 0; n < frames; n++) {
+        render_frame(n);
+        if (flush_frame()) {
+            display_lines_send(&shadow, mock_spi_write);
+        }
+    }
+    return now_us() - start;
+}
+
+static uint64_t run_async(int frames) {
+    pthread_t thread;
+
+    reset();
+    pthread_create(&thread, NULL, flush_thread, NULL);
+    const uint64_t start = now_us();
+
+    for (int n = 0; n < frames; n++) {
+        render_frame(n);
+        pthread_mutex_lock(&shadow_lock);
+        if (flush_frame()) {
+            flush_queued++;
+            flush_signalled = true;
+            pthread_cond_broadcast(&flush_cond);
+        }
+        pthread_mutex_unlock(&shadow_lock);
+    }
+
+    // display_flush_sync()
+    pthread_mutex_lock(&shadow_lock);
+    while (flush_written != flush_queued) {
+        pthread_cond_wait(&flush_cond, &shadow_lock);
+    }
+    const uint64_t elapsed = now_us() - start;
+    flush_stop = true;
+    pthread_cond_broadcast(&flush_cond);
+    pthread_mutex_unlock(&shadow_lock);
+
+    pthread_join(thread, NULL);
+    return elapsed;
+}
+
+int main(int argc, char **argv) {
+    const int frames = argc > 1 ? atoi(argv[1]) : 50;
+    int failures = 0;
+
+    const uint64_t sync_us = run_sync(frames);
+    const uint32_t sync_lines = lines_sent;
+    failures += memcmp(panel, frame, sizeof(frame)) != 0;
+
+    const uint64_t async_us = run_async(frames);
+    const uint32_t async_lines = lines_sent;
+    failures += memcmp(panel, frame, sizeof(frame)) != 0;
+
+    // Every frame waits for its transfer when sending synchronously, so
+    // overlapping them must save at least half the transfer time
+    const uint64_t transfer_us = (uint64_t)frames * CHANGED_ROWS * LINE_US;
+    failures += async_us + transfer_us / 2 > sync_us;
+
+    printf("sync %llu us %u lines, async %llu us %u lines, %d frames, %llu us on the wire\n",
+           (unsigned long long)sync_us, sync_lines, (unsigned long long)async_us, async_lines,
+           frames, (unsigned long long)transfer_us);
+    printf("flush_latency_test: %d failures\n", failures);
+    return failures == 0 ? 0 : 1;
+}
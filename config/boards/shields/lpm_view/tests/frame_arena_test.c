@@ -0,0 +1,147 @@
+/*
+ *
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "frame_arena.h"
+
+// Drives the frame arena through the glyph buffer pattern of LVGL's label
+// rendering, with a mock of LVGL's font draw-buffer handlers behind it, and
+// checks that glyph buffers come from the arena, that it rewinds after each
+// label and frame, and that what does not fit goes to the heap and is counted.
+
+static int failures;
+static int heap_allocs;
+static int heap_frees;
+
+static void *mock_heap_malloc(size_t size, lv_color_format_t color_format) {
+    heap_allocs++;
+    return malloc(size);
+}
+
+static void mock_heap_free(void *buf) {
+    heap_frees++;
+    free(buf);
+}
+
+static lv_draw_buf_handlers_t handlers = {
+    .buf_malloc_cb = mock_heap_malloc,
+    .buf_free_cb = mock_heap_free,
+};
+
+lv_draw_buf_handlers_t *lv_draw_buf_get_font_handlers(void) { return &handlers; }
+
+static void check(bool ok, const char *what) {
+    if (!ok) {
+        failures++;
+        printf("FAIL %s\n", what);
+    }
+}
+
+static struct frame_arena_stats stats(void) {
+    struct frame_arena_stats out;
+
+    frame_arena_get_stats(&out);
+    return out;
+}
+
+static void *glyph_alloc(size_t size) {
+    return handlers.buf_malloc_cb(size, LV_COLOR_FORMAT_A8);
+}
+
+static void glyph_free(void *buf) { handlers.buf_free_cb(buf); }
+
+static void init(void) {
+    frame_arena_init(18);
+
+    check(stats().worst_case == FRAME_ARENA_WORST_CASE(18), "worst case of the largest font");
+    check(stats().worst_case <= stats().size, "worst case fits the configured arena");
+}
+
+// One label: a glyph buffer, replaced by a larger one for a taller glyph
+// before the first is freed, as LVGL does
+static void label(void) {
+    const size_t small = FRAME_ARENA_GLYPH_BUF_SIZE(14) / 2;
+    const size_t large = FRAME_ARENA_GLYPH_BUF_SIZE(18);
+
+    uint8_t *a = glyph_alloc(small);
+    uint8_t *b = glyph_alloc(large);
+
+    check(a != NULL && b != NULL, "label buffers allocated");
+    check(heap_allocs == 0, "label buffers come from the arena");
+    check((uintptr_t)a % LV_DRAW_BUF_ALIGN == 0 && (uintptr_t)b % LV_DRAW_BUF_ALIGN == 0,
+          "label buffers aligned");
+
+    memset(a, 0xaa, small);
+    memset(b, 0x55, large);
+    check(a[small - 1] == 0xaa, "label buffers do not overlap");
+
+    glyph_free(a);
+    check(stats().used != 0, "arena held while a buffer is in use");
+    glyph_free(b);
+    check(stats().used == 0, "arena rewinds after the label");
+    check(stats().high_water >= small + large, "high water covers both buffers");
+    check(stats().high_water <= stats().worst_case, "high water within the worst case");
+    check(heap_frees == 0, "arena buffers not freed to the heap");
+}
+
+// Repeated labels do not raise the peak
+static void labels(void) {
+    const uint32_t high_water = stats().high_water;
+
+    for (int i = 0; i < 20; i++) {
+        label();
+    }
+    frame_arena_end_frame();
+    check(stats().high_water == high_water, "peak does not grow with labels");
+    check(stats().held_frames == 0, "no frame ends with buffers held");
+}
+
+static void overflow(void) {
+    const int allocs = heap_allocs;
+    void *big = glyph_alloc(stats().size + 1);
+
+    check(big != NULL && heap_allocs == allocs + 1, "oversized buffer comes from the heap");
+    check(stats().overflows == 1, "oversized buffer counted");
+    check(stats().used == 0, "oversized buffer leaves the arena alone");
+    glyph_free(big);
+    check(heap_frees == 1, "oversized buffer freed to the heap");
+}
+
+static void held_frame(void) {
+    void *held = glyph_alloc(64);
+
+    frame_arena_end_frame();
+    check(stats().held_frames == 1, "frame with a buffer in use counted");
+    check(stats().used != 0, "arena not reset under a buffer in use");
+    glyph_free(held);
+    check(stats().used == 0, "arena rewinds once the buffer is freed");
+}
+
+static void reset(void) {
+    const uint32_t worst_case = stats().worst_case;
+
+    frame_arena_reset_stats();
+    check(stats().overflows == 0 && stats().held_frames == 0, "counters reset");
+    check(stats().worst_case == worst_case, "worst case kept across a reset");
+}
+
+int main(void) {
+    init();
+    label();
+    labels();
+    overflow();
+    held_frame();
+    reset();
+
+    printf("frame_arena_test: %d failures\n", failures);
+    return failures == 0 ? 0 : 1;
+}
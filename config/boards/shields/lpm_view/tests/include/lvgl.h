@@ -0,0 +1,51 @@
+/*
+ *
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+// Host stand-in for the LVGL image types used by the generated artwork, and
+// for the draw buffer handlers and fonts the frame arena uses
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define LV_IMAGE_HEADER_MAGIC 0x19
+#define LV_IMAGE_FLAGS_USER1 0x0100
+#define LV_COLOR_FORMAT_L8 0x06
+
+typedef struct {
+    uint32_t magic : 8;
+    uint32_t cf : 8;
+    uint32_t flags : 16;
+    uint32_t w : 16;
+    uint32_t h : 16;
+    uint32_t stride : 16;
+    uint32_t reserved_2 : 16;
+} lv_image_header_t;
+
+typedef struct {
+    lv_image_header_t header;
+    uint32_t data_size;
+    const uint8_t *data;
+} lv_image_dsc_t;
+
+typedef uint8_t lv_color_format_t;
+
+#define LV_COLOR_FORMAT_A8 0x0e
+#define LV_DRAW_BUF_ALIGN 4
+// A8 only, with the stride alignment of 1 the firmware uses
+#define LV_DRAW_BUF_STRIDE(w, cf) (w)
+
+typedef void *(*lv_draw_buf_malloc_cb)(size_t size, lv_color_format_t color_format);
+typedef void (*lv_draw_buf_free_cb)(void *buf);
+
+typedef struct {
+    lv_draw_buf_malloc_cb buf_malloc_cb;
+    lv_draw_buf_free_cb buf_free_cb;
+} lv_draw_buf_handlers_t;
+
+lv_draw_buf_handlers_t *lv_draw_buf_get_font_handlers(void);
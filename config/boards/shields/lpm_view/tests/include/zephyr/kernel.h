@@ -0,0 +1,27 @@
+/*
+ *
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+// Host stand-in for the parts of the Zephyr kernel API the widgets use. The
+// tests are single-threaded, so spinlocks do nothing.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/sys/util.h>
+
+#define __aligned(x) __attribute__((__aligned__(x)))
+
+struct k_spinlock {
+    int unused;
+};
+
+typedef int k_spinlock_key_t;
+
+static inline k_spinlock_key_t k_spin_lock(struct k_spinlock *lock) { return 0; }
+static inline void k_spin_unlock(struct k_spinlock *lock, k_spinlock_key_t key) {}
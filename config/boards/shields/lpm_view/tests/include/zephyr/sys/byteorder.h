@@ -0,0 +1,20 @@
+/*
+ *
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+// Host stand-in for the parts of Zephyr's byteorder.h the widgets use
+
+#include <stdint.h>
+
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define sys_be32_to_cpu(val) ((uint32_t)(val))
+#define sys_cpu_to_be32(val) ((uint32_t)(val))
+#else
+#define sys_be32_to_cpu(val) __builtin_bswap32(val)
+#define sys_cpu_to_be32(val) __builtin_bswap32(val)
+#endif
@@ -0,0 +1,24 @@
+/*
+ *
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+// Host stand-in for the parts of Zephyr's util.h the widgets use
+
+#define BIT(n) (1UL << (n))
+#define MIN(a, b) (((a) < (b)) ? (a) : (b))
+#define MAX(a, b) (((a) > (b)) ? (a) : (b))
+#define DIV_ROUND_UP(n, d) (((n) + (d)-1) / (d))
+#define ARRAY_SIZE(array) (sizeof(array) / sizeof((array)[0]))
+#define ROUND_UP(x, align) ((((x) + (align)-1) / (align)) * (align))
+
+// 1 for Kconfig options defined to 1, 0 for undefined ones, usable in #if
+#define IS_ENABLED(config_macro) Z_IS_ENABLED1(config_macro)
+#define Z_IS_ENABLED1(config_macro) Z_IS_ENABLED2(_XXXX##config_macro)
+#define _XXXX1 _YYYY,
+#define Z_IS_ENABLED2(one_or_two_args) Z_IS_ENABLED3(one_or_two_args 1, 0)
+#define Z_IS_ENABLED3(ignore_this, val, ...) val
@@ -0,0 +1,196 @@
+/*
+ *
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "mono.h"
+#include "ref.h"
+
+// Times the mono kernels against the pixel-by-pixel reference, or against the
+// path they replaced, on the shapes the widgets draw. Prints one
+// "name before_ns after_ns" line per case, so runs can be compared from commit
+// to commit. Host timings only show the ratio; the firmware cycle counts come
+// from NICE_VIEW_WIDGET_PROFILE.
+//
+// Given a side, it times only that one and prints lpm_bench slot records of
+// script "mono" instead, the format of the NICE_VIEW_WIDGET_BENCH output, so
+// the two sides can be compared with scripts/bench_compare.py.
+//
+// Usage: mono_bench [iterations] [before|after]
+
+#define STRIDE 9
+
+static uint8_t canvas[68 * STRIDE];
+static uint8_t art[68 * STRIDE];
+static uint8_t scratch[68 * 68];
+static uint8_t l8_canvas[68 * 68];
+static uint8_t l8_copy[68 * 68];
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+// Full canvas background, as cleared before each redraw
+static void ref_clear(int i) {
+    for (int32_t y = 0; y < 68; y++) {
+        ref_fill_span(canvas + y * STRIDE, 0, 68, i & 1);
+    }
+}
+
+static void mono_clear(int i) { mono_fill_rect(canvas, STRIDE, 0, 0, 68, 68, i & 1); }
+
+// Battery bar at an odd offset
+static void ref_bar(int i) {
+    for (int32_t y = 0; y < 4; y++) {
+        ref_fill_span(canvas + (y + 9) * STRIDE, 3, 25, i & 1);
+    }
+}
+
+static void mono_bar(int i) { mono_fill_rect(canvas, STRIDE, 3, 9, 25, 4, i & 1); }
+
+// Selection highlight
+static void ref_invert(int i) {
+    for (int32_t y = 0; y < 14; y++) {
+        ref_invert_span(canvas + y * STRIDE, 1, 66);
+    }
+}
+
+static void mono_invert(int i) {
+    for (int32_t y = 0; y < 14; y++) {
+        mono_invert_span(canvas + y * STRIDE, 1, 66);
+    }
+}
+
+// Artwork copied to a different bit alignment
+static void ref_art(int i) {
+    for (int32_t y = 0; y < 60; y++) {
+        ref_blit_row(canvas + y * STRIDE, 5, art + y * STRIDE, 0, 60, MONO_OP_COPY);
+    }
+}
+
+static void mono_art(int i) {
+    mono_blit(canvas, STRIDE, 5, 0, art, STRIDE, 0, 0, 60, 60, MONO_OP_COPY);
+}
+
+// One step of the WPM graph scroll within the canvas
+static void ref_scroll(int i) {
+    for (int32_t y = 0; y < 30; y++) {
+        ref_blit_row(canvas + y * STRIDE, 2, canvas + (y + 1) * STRIDE, 2, 64, MONO_OP_COPY);
+    }
+}
+
+static void mono_scroll(int i) {
+    mono_blit(canvas, STRIDE, 2, 0, canvas, STRIDE, 2, 1, 64, 30, MONO_OP_COPY);
+}
+
+// Rotating a finished L8 canvas in place: copy it aside, then rotate it back
+static void l8_rotate_copy(int i) {
+    memcpy(l8_copy, l8_canvas, sizeof(l8_copy));
+    for (int32_t y = 0; y < 68; y++) {
+        for (int32_t x = 0; x < 68; x++) {
+            l8_canvas[(67 - x) * 68 + y] = l8_copy[y * 68 + x];
+        }
+    }
+}
+
+// Rotating the L8 scratch canvas straight into an L8 canvas
+static void l8_rotate_scratch(int i) {
+    for (int32_t y = 0; y < 68; y++) {
+        for (int32_t x = 0; x < 68; x++) {
+            l8_canvas[(67 - x) * 68 + y] = scratch[y * 68 + x];
+        }
+    }
+}
+
+// Rotating the L8 scratch canvas straight into the packed canvas
+static void mono_rotate(int i) {
+    static const struct mono_area full = {0, 0, 67, 67};
+
+    mono_rotate_l8(canvas, STRIDE, 0, 0, scratch, 68, 68, &full, 0xff);
+}
+
+static const struct {
+    const char *name;
+    void (*before)(int i);
+    void (*after)(int i);
+} cases[] = {
+    {"clear_canvas", ref_clear, mono_clear},   {"battery_bar", ref_bar, mono_bar},
+    {"invert_rows", ref_invert, mono_invert}, {"blit_art", ref_art, mono_art},
+    {"scroll_graph", ref_scroll, mono_scroll},
+    // The copy-then-rotate round trip against rotating out of the scratch canvas
+    {"rotate_scratch", l8_rotate_copy, l8_rotate_scratch},
+    // Rotating into an L8 canvas against rotating into a packed one
+    {"rotate_packed", l8_rotate_scratch, mono_rotate},
+};
+
+static uint64_t time_case(void (*fn)(int i), int iterations) {
+    const uint64_t start = now_ns();
+
+    for (int i = 0; i < iterations; i++) {
+        fn(i);
+    }
+    return (now_ns() - start) / iterations;
+}
+
+static void capture_case(const char *name, void (*fn)(int i), int iterations) {
+    uint64_t total = 0;
+    uint64_t max = 0;
+
+    for (int i = 0; i < iterations; i++) {
+        const uint64_t start = now_ns();
+
+        fn(i);
+
+        const uint64_t elapsed = now_ns() - start;
+        total += elapsed;
+        max = elapsed > max ? elapsed : max;
+    }
+
+    printf("lpm_bench,slot,mono,%s,%d,%llu,%llu\n", name, iterations,
+           (unsigned long long)(total / 1000), (unsigned long long)(max / 1000));
+}
+
+int main(int argc, char **argv) {
+    const int iterations = argc > 1 ? atoi(argv[1]) : 100000;
+    const char *side = argc > 2 ? argv[2] : NULL;
+
+    if (side != NULL && strcmp(side, "before") != 0 && strcmp(side, "after") != 0) {
+        fprintf(stderr, "usage: mono_bench [iterations] [before|after]\n");
+        return 2;
+    }
+
+    for (size_t i = 0; i < sizeof(art); i++) {
+        art[i] = (uint8_t)ref_random();
+    }
+    for (size_t i = 0; i < sizeof(scratch); i++) {
+        scratch[i] = ref_random() & 1 ? 0xff : 0x00;
+        l8_canvas[i] = scratch[i];
+    }
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        if (side != NULL) {
+            capture_case(cases[i].name, side[0] == 'b' ? cases[i].before : cases[i].after,
+                         iterations);
+            continue;
+        }
+
+        const uint64_t before = time_case(cases[i].before, iterations);
+        const uint64_t after = time_case(cases[i].after, iterations);
+
+        printf("%s %llu %llu\n", cases[i].name, (unsigned long long)before,
+               (unsigned long long)after);
+    }
+
+    return 0;
+}
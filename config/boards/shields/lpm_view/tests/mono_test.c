@@ -0,0 +1,195 @@
+/*
+ *
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "mono.h"
+#include "ref.h"
+
+// Checks every kernel in widgets/mono.c against the pixel-by-pixel reference:
+// exhaustively over the spans of a buffer small enough to cover every start and
+// end bit and every word boundary, then on random rows, rectangles and rotated
+// areas.
+
+#define ROW_BYTES 20
+#define ROW_PIXELS (ROW_BYTES * 8)
+#define RANDOM_ROUNDS 200000
+
+static int failures;
+
+static void check(bool ok, const char *what, int32_t a, int32_t b, int32_t w, int op) {
+    if (!ok && failures++ < 10) {
+        printf("FAIL %s a=%d b=%d w=%d op=%d\n", what, a, b, w, op);
+    }
+}
+
+static void random_bytes(uint8_t *buf, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        buf[i] = (uint8_t)ref_random();
+    }
+}
+
+static void check_fill(int32_t x, int32_t w, bool set) {
+    uint8_t row[ROW_BYTES], want[ROW_BYTES];
+
+    random_bytes(row, sizeof(row));
+    memcpy(want, row, sizeof(row));
+    mono_fill_span(row, x, w, set);
+    ref_fill_span(want, x, w, set);
+    check(memcmp(row, want, sizeof(row)) == 0, "mono_fill_span", x, set, w, 0);
+}
+
+static void check_invert(int32_t x, int32_t w) {
+    uint8_t row[ROW_BYTES], want[ROW_BYTES];
+
+    random_bytes(row, sizeof(row));
+    memcpy(want, row, sizeof(row));
+    mono_invert_span(row, x, w);
+    ref_invert_span(want, x, w);
+    check(memcmp(row, want, sizeof(row)) == 0, "mono_invert_span", x, 0, w, 0);
+}
+
+static void check_blit_row(int32_t dx, int32_t sx, int32_t w, enum mono_op op) {
+    uint8_t src[ROW_BYTES], src_before[ROW_BYTES], dst[ROW_BYTES], want[ROW_BYTES];
+
+    random_bytes(src, sizeof(src));
+    random_bytes(dst, sizeof(dst));
+    memcpy(src_before, src, sizeof(src));
+    memcpy(want, dst, sizeof(dst));
+    mono_blit_row(dst, dx, src, sx, w, op);
+    ref_blit_row(want, dx, src, sx, w, op);
+    check(memcmp(dst, want, sizeof(dst)) == 0, "mono_blit_row", dx, sx, w, op);
+    check(memcmp(src, src_before, sizeof(src)) == 0, "mono_blit_row source", dx, sx, w, op);
+}
+
+// Every start and width within the first 80 pixels, which spans three words
+static void exhaustive_spans(void) {
+    for (int32_t x = 0; x < 80; x++) {
+        for (int32_t w = 0; x + w <= 80; w++) {
+            check_fill(x, w, true);
+            check_fill(x, w, false);
+            check_invert(x, w);
+        }
+    }
+}
+
+// Every destination and source alignment for widths of 1 up to just past the
+// word size, and a few that need several words
+static void exhaustive_blits(void) {
+    static const int32_t widths[] = {1, 2, 7, 8, 9, 15, 16, 17, 31, 32, 33, 39, 40, 41, 63, 64, 65, 97};
+
+    for (int op = MONO_OP_COPY; op <= MONO_OP_XOR; op++) {
+        for (size_t i = 0; i < sizeof(widths) / sizeof(widths[0]); i++) {
+            for (int32_t dx = 0; dx < 16; dx++) {
+                for (int32_t sx = 0; sx < 16; sx++) {
+                    check_blit_row(dx, sx, widths[i], op);
+                }
+            }
+        }
+    }
+}
+
+static void random_rows(void) {
+    for (int i = 0; i < RANDOM_ROUNDS; i++) {
+        const int32_t w = ref_random() % 120;
+        const int32_t dx = ref_random() % (ROW_PIXELS - w + 1);
+        const int32_t sx = ref_random() % (ROW_PIXELS - w + 1);
+
+        switch (ref_random() % 3) {
+        case 0:
+            check_fill(dx, w, ref_random() & 1);
+            break;
+        case 1:
+            check_invert(dx, w);
+            break;
+        default:
+            check_blit_row(dx, sx, w, ref_random() % (MONO_OP_XOR + 1));
+            break;
+        }
+    }
+}
+
+// The canvas geometry: 68 pixels in 9 byte rows
+static void rects(void) {
+    uint8_t buf[68 * 9], want[68 * 9];
+
+    for (int i = 0; i < 2000; i++) {
+        const int32_t w = ref_random() % 69, h = ref_random() % 69;
+        const int32_t x = ref_random() % (69 - w), y = ref_random() % (69 - h);
+        const bool set = ref_random() & 1;
+
+        random_bytes(buf, sizeof(buf));
+        memcpy(want, buf, sizeof(buf));
+        mono_fill_rect(buf, 9, x, y, w, h, set);
+        for (int32_t r = 0; r < h; r++) {
+            ref_fill_span(want + (y + r) * 9, x, w, set);
+        }
+        check(memcmp(buf, want, sizeof(buf)) == 0, "mono_fill_rect", x, y, w, set);
+    }
+}
+
+// Scrolling within one buffer, as the WPM graph does, in both directions
+static void overlapping_blits(void) {
+    uint8_t buf[12 * 9], want[12 * 9];
+
+    for (int down = 0; down <= 1; down++) {
+        for (int32_t shift = 1; shift < 4; shift++) {
+            const int32_t src_y = down ? 0 : shift, dst_y = down ? shift : 0;
+            const int32_t h = 12 - shift;
+
+            random_bytes(buf, sizeof(buf));
+            memcpy(want, buf, sizeof(buf));
+            mono_blit(buf, 9, 3, dst_y, buf, 9, 5, src_y, 50, h, MONO_OP_COPY);
+
+            uint8_t rows[12 * 9];
+            memcpy(rows, want, sizeof(rows));
+            for (int32_t r = 0; r < h; r++) {
+                ref_blit_row(want + (dst_y + r) * 9, 3, rows + (src_y + r) * 9, 5, 50,
+                             MONO_OP_COPY);
+            }
+            check(memcmp(buf, want, sizeof(buf)) == 0, "mono_blit overlap", down, shift, 50,
+                  MONO_OP_COPY);
+        }
+    }
+}
+
+// Canvas areas rotated out of the L8 scratch canvas, into the canvas itself and
+// into a sprite that starts at the area
+static void rotations(void) {
+    uint8_t src[68 * 68], dst[68 * 9], want[68 * 9];
+
+    for (int i = 0; i < 5000; i++) {
+        const int32_t w = 1 + ref_random() % 68, h = 1 + ref_random() % 68;
+        const int32_t x = ref_random() % (69 - w), y = ref_random() % (69 - h);
+        const struct mono_area area = {x, y, x + w - 1, y + h - 1};
+        const uint8_t background = ref_random() & 1 ? 0xff : 0x00;
+        const bool sprite = ref_random() & 1;
+        const int32_t row0 = sprite ? 67 - area.x2 : 0, byte0 = sprite ? area.y1 / 8 : 0;
+
+        random_bytes(src, sizeof(src));
+        random_bytes(dst, sizeof(dst));
+        memcpy(want, dst, sizeof(dst));
+        mono_rotate_l8(dst, 9, row0, byte0, src, 68, 68, &area, background);
+        ref_rotate_l8(want, 9, row0, byte0, src, 68, 68, &area, background);
+        check(memcmp(dst, want, sizeof(dst)) == 0, "mono_rotate_l8", x, y, w, h);
+    }
+}
+
+int main(void) {
+    exhaustive_spans();
+    exhaustive_blits();
+    random_rows();
+    rects();
+    overlapping_blits();
+    rotations();
+
+    printf("mono_test: %d failures\n", failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,82 @@
+/*
+ *
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "mono.h"
+
+// Pixel-by-pixel versions of the mono kernels, written for obviousness rather
+// than speed, and a small deterministic generator for test data
+
+static inline uint32_t ref_random(void) {
+    static uint32_t state = 0x2545f491;
+
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+static inline bool ref_get(const uint8_t *row, int32_t x) {
+    return (row[x / 8] >> (7 - x % 8)) & 1;
+}
+
+static inline void ref_put(uint8_t *row, int32_t x, bool set) {
+    if (set) {
+        row[x / 8] |= 0x80 >> (x % 8);
+    } else {
+        row[x / 8] &= ~(0x80 >> (x % 8));
+    }
+}
+
+static inline void ref_fill_span(uint8_t *row, int32_t x, int32_t w, bool set) {
+    for (int32_t i = 0; i < w; i++) {
+        ref_put(row, x + i, set);
+    }
+}
+
+static inline void ref_invert_span(uint8_t *row, int32_t x, int32_t w) {
+    for (int32_t i = 0; i < w; i++) {
+        ref_put(row, x + i, !ref_get(row, x + i));
+    }
+}
+
+static inline void ref_blit_row(uint8_t *dst, int32_t dx, const uint8_t *src, int32_t sx,
+                                int32_t w, enum mono_op op) {
+    for (int32_t i = 0; i < w; i++) {
+        const bool s = ref_get(src, sx + i), d = ref_get(dst, dx + i);
+
+        switch (op) {
+        case MONO_OP_COPY:
+            ref_put(dst, dx + i, s);
+            break;
+        case MONO_OP_OR:
+            ref_put(dst, dx + i, d || s);
+            break;
+        case MONO_OP_CLEAR:
+            ref_put(dst, dx + i, d && !s);
+            break;
+        case MONO_OP_XOR:
+            ref_put(dst, dx + i, d != s);
+            break;
+        }
+    }
+}
+
+static inline void ref_rotate_l8(uint8_t *dst, uint32_t dst_stride, int32_t row0, int32_t byte0,
+                                 const uint8_t *src, uint32_t src_stride, int32_t size,
+                                 const struct mono_area *area, uint8_t background) {
+    for (int32_t y = area->y1; y <= area->y2; y++) {
+        for (int32_t x = area->x1; x <= area->x2; x++) {
+            const bool set = (src[y * src_stride + x] ^ background) & 0x80;
+            ref_put(dst + (size - 1 - x - row0) * dst_stride, y - byte0 * 8, set);
+        }
+    }
+}
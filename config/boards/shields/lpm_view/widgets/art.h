@@ -0,0 +1,22 @@
+/*
+ *
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <lvgl.h>
+#include <zephyr/sys/util.h>
+
+// Marks images generated by scripts/art_compress.py so only art_decoder.c
+// claims them
+#define ART_IMAGE_FLAG LV_IMAGE_FLAGS_USER1
+
+// Compressed peripheral artwork, generated from widgets/art/*.png at build time
+extern const lv_image_dsc_t *const art_images[];
+extern const size_t art_image_count;
+
+// Registers the LVGL image decoder that expands the artwork a few rows at a time
+void art_decoder_init(void);
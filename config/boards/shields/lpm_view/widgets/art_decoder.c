@@ -0,0 +1,148 @@
+/*
+ *
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <zephyr/kernel.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include "art.h"
+#include "art_stream.h"
+#include "profile.h"
+
+// Rows expanded per get_area call; the band is the only 8 bpp buffer needed
+#define ART_BAND_ROWS 4
+
+#define ART_FOREGROUND (IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_INVERTED) ? 0x00 : 0xff)
+#define ART_BACKGROUND (IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_INVERTED) ? 0xff : 0x00)
+
+struct art_state {
+    struct art_stream stream;
+    lv_draw_buf_t *band;
+    uint8_t rows[];
+};
+
+static bool is_art(const lv_image_decoder_dsc_t *dsc) {
+    if (dsc->src_type != LV_IMAGE_SRC_VARIABLE) {
+        return false;
+    }
+
+    const lv_image_dsc_t *img = dsc->src;
+    return img->header.magic == LV_IMAGE_HEADER_MAGIC && (img->header.flags & ART_IMAGE_FLAG);
+}
+
+static lv_result_t art_info(lv_image_decoder_t *decoder, lv_image_decoder_dsc_t *dsc,
+                            lv_image_header_t *header) {
+    if (!is_art(dsc)) {
+        return LV_RESULT_INVALID;
+    }
+
+    const lv_image_dsc_t *img = dsc->src;
+    *header = img->header;
+    header->cf = LV_COLOR_FORMAT_L8;
+    header->stride = img->header.w;
+    return LV_RESULT_OK;
+}
+
+static lv_result_t art_open(lv_image_decoder_t *decoder, lv_image_decoder_dsc_t *dsc) {
+    const lv_image_dsc_t *img = dsc->src;
+
+    struct art_state *s = lv_malloc(sizeof(*s) + ART_STREAM_ROWS_SIZE(img->header.w));
+    if (s == NULL) {
+        return LV_RESULT_INVALID;
+    }
+
+    s->band = lv_draw_buf_create(img->header.w, ART_BAND_ROWS, LV_COLOR_FORMAT_L8,
+                                 LV_STRIDE_AUTO);
+    if (s->band == NULL) {
+        lv_free(s);
+        return LV_RESULT_INVALID;
+    }
+
+    art_stream_init(&s->stream, img->data, img->data_size, img->header.w, s->rows);
+
+    // Leaving decoded unset makes LVGL pull the image through get_area in bands
+    dsc->user_data = s;
+    dsc->decoded = NULL;
+    return LV_RESULT_OK;
+}
+
+static lv_result_t art_get_area(lv_image_decoder_t *decoder, lv_image_decoder_dsc_t *dsc,
+                                const lv_area_t *full_area, lv_area_t *decoded_area) {
+    struct art_state *state = dsc->user_data;
+    struct art_stream *s = &state->stream;
+    int32_t y = decoded_area->y1 == LV_COORD_MIN ? full_area->y1 : decoded_area->y2 + 1;
+    if (y > full_area->y2) {
+        return LV_RESULT_INVALID;
+    }
+
+    profile_time_t start = profile_start();
+    lv_result_t res = LV_RESULT_OK;
+
+    // Rows only decode forward, so rewind when LVGL redraws an earlier part
+    if (y < s->row) {
+        art_stream_reset(s);
+    }
+    while (s->row < y) {
+        if (art_stream_decode_row(s) < 0) {
+            res = LV_RESULT_INVALID;
+            goto out;
+        }
+    }
+
+    int32_t rows = MIN(ART_BAND_ROWS, full_area->y2 - y + 1);
+    lv_draw_buf_t *band = state->band;
+    for (int32_t r = 0; r < rows; r++) {
+        if (art_stream_decode_row(s) < 0) {
+            res = LV_RESULT_INVALID;
+            goto out;
+        }
+
+        uint8_t *out = band->data + r * band->header.stride;
+        for (int32_t x = full_area->x1; x <= full_area->x2; x++) {
+            bool set = s->cur[x >> 3] & BIT(7 - (x & 7));
+            *out++ = set ? ART_FOREGROUND : ART_BACKGROUND;
+        }
+    }
+
+    band->header.w = lv_area_get_width(full_area);
+    band->header.h = rows;
+    decoded_area->x1 = full_area->x1;
+    decoded_area->x2 = full_area->x2;
+    decoded_area->y1 = y;
+    decoded_area->y2 = y + rows - 1;
+    dsc->decoded = band;
+
+out:
+    profile_stop(PROFILE_ART_DECODE, start);
+    if (res != LV_RESULT_OK) {
+        LOG_ERR("Corrupt artwork at row %d", s->row);
+    }
+    return res;
+}
+
+static void art_close(lv_image_decoder_t *decoder, lv_image_decoder_dsc_t *dsc) {
+    struct art_state *s = dsc->user_data;
+
+    lv_draw_buf_destroy(s->band);
+    lv_free(s);
+    dsc->user_data = NULL;
+    dsc->decoded = NULL;
+}
+
+void art_decoder_init(void) {
+    static lv_image_decoder_t *decoder;
+    if (decoder != NULL) {
+        return;
+    }
+
+    decoder = lv_image_decoder_create();
+    lv_image_decoder_set_info_cb(decoder, art_info);
+    lv_image_decoder_set_open_cb(decoder, art_open);
+    lv_image_decoder_set_get_area_cb(decoder, art_get_area);
+    lv_image_decoder_set_close_cb(decoder, art_close);
+}
@@ -0,0 +1,129 @@
+/*
+ *
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <string.h>
+#include <zephyr/sys/util.h>
+
+#include "art_stream.h"
+
+enum art_predictor {
+    ART_PREDICT_NONE,
+    ART_PREDICT_UP,
+    ART_PREDICT_UP2,
+    ART_PREDICT_UP_LEFT,
+    ART_PREDICT_UP_RIGHT,
+};
+
+static int read_bit(struct art_stream *s) {
+    if (s->pos >= s->bits) {
+        return -EINVAL;
+    }
+
+    int bit = (s->data[s->pos >> 3] >> (7 - (s->pos & 7))) & 1;
+    s->pos++;
+    return bit;
+}
+
+static int read_bits(struct art_stream *s, int count) {
+    int value = 0;
+    while (count--) {
+        int bit = read_bit(s);
+        if (bit < 0) {
+            return bit;
+        }
+        value = (value << 1) | bit;
+    }
+    return value;
+}
+
+// Elias gamma code: n zero bits, then the n + 1 bit value starting with its 1
+static int read_gamma(struct art_stream *s) {
+    int zeros = 0;
+    int bit;
+    while ((bit = read_bit(s)) == 0) {
+        zeros++;
+    }
+    if (bit < 0 || zeros > 15) {
+        return -EINVAL;
+    }
+
+    int rest = read_bits(s, zeros);
+    return rest < 0 ? rest : (1 << zeros) | rest;
+}
+
+void art_stream_init(struct art_stream *s, const uint8_t *data, uint32_t size, uint16_t width,
+                     uint8_t *rows) {
+    s->data = data;
+    s->bits = size * 8;
+    s->width = width;
+    s->stride = DIV_ROUND_UP(width, 8);
+    s->rows = rows;
+    s->cur = rows;
+    s->up1 = rows + s->stride;
+    s->up2 = rows + 2 * s->stride;
+    art_stream_reset(s);
+}
+
+void art_stream_reset(struct art_stream *s) {
+    s->pos = 0;
+    s->row = 0;
+    memset(s->rows, 0, 3 * s->stride);
+}
+
+int art_stream_decode_row(struct art_stream *s) {
+    uint8_t *prev = s->up2;
+    s->up2 = s->up1;
+    s->up1 = s->cur;
+    s->cur = prev;
+
+    switch (read_bits(s, 3)) {
+    case ART_PREDICT_NONE:
+        memset(s->cur, 0, s->stride);
+        break;
+    case ART_PREDICT_UP:
+        memcpy(s->cur, s->up1, s->stride);
+        break;
+    case ART_PREDICT_UP2:
+        memcpy(s->cur, s->up2, s->stride);
+        break;
+    case ART_PREDICT_UP_LEFT:
+        for (int i = s->stride - 1; i >= 0; i--) {
+            s->cur[i] = (s->up1[i] >> 1) | (i > 0 ? s->up1[i - 1] << 7 : 0);
+        }
+        break;
+    case ART_PREDICT_UP_RIGHT:
+        for (int i = 0; i < s->stride; i++) {
+            s->cur[i] = (s->up1[i] << 1) | (i + 1 < s->stride ? s->up1[i + 1] >> 7 : 0);
+        }
+        break;
+    default:
+        return -EINVAL;
+    }
+
+    // Each code skips n - 1 pixels that match the prediction and flips the next
+    for (int x = 0; x < s->width;) {
+        int n = read_gamma(s);
+        if (n < 0) {
+            return n;
+        }
+        x += n - 1;
+        if (x < s->width) {
+            s->cur[x >> 3] ^= BIT(7 - (x & 7));
+            x++;
+        }
+    }
+
+    // Keep the padding clear so shifted predictions stay in bounds
+    if (s->width & 7) {
+        s->cur[s->stride - 1] &= 0xff << (8 - (s->width & 7));
+    }
+
+    s->row++;
+    return 0;
+}
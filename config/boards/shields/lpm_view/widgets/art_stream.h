@@ -0,0 +1,39 @@
+/*
+ *
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+// Row decoder for the artwork format written by scripts/art_compress.py. Kept
+// apart from the LVGL image decoder in art_decoder.c so it can be tested and
+// timed on the host.
+
+struct art_stream {
+    const uint8_t *data;
+    uint32_t bits;
+    uint32_t pos;
+    // Next row to decode
+    int32_t row;
+    uint16_t width;
+    uint16_t stride;
+    // Current row and the two above it, packed 1 bpp MSB first
+    uint8_t *cur;
+    uint8_t *up1;
+    uint8_t *up2;
+    uint8_t *rows;
+};
+
+// Bytes of row storage a stream of the given width needs
+#define ART_STREAM_ROWS_SIZE(width) (3 * (((width) + 7) / 8))
+
+void art_stream_init(struct art_stream *s, const uint8_t *data, uint32_t size, uint16_t width,
+                     uint8_t *rows);
+// Rewinds to the first row
+void art_stream_reset(struct art_stream *s);
+// Decodes the next row into s->cur. Returns -EINVAL on corrupt data.
+int art_stream_decode_row(struct art_stream *s);
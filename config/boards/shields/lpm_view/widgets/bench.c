@@ -0,0 +1,155 @@
+/*
+ *
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+#include <lvgl.h>
+#include <zmk/display.h>
+#include "bench.h"
+#include "profile.h"
+#include "../display_flush.h"
+
+// Replays fixed event scripts through the status widget once after boot and
+// prints one CSV record per measurement. The central widget replays WPM, layer,
+// profile and battery updates, the peripheral widget battery and connection
+// updates.
+//
+//   lpm_bench,slot,<script>,<slot>,<calls>,<total_us>,<max_us>
+//   lpm_bench,total,<script>,<frames>,<bytes>,<lines>,<written>
+//
+// Every event is rendered and refreshed straight away, so each one costs a
+// frame. draw_* time includes the rotation time it triggers, bytes counts the
+// 1 bpp pixel data invalidated on the display, and lines and written count what
+// the line flush actually sent to the panel.
+
+#define BENCH_START_DELAY K_SECONDS(2)
+
+struct bench_script {
+    const char *name;
+    const struct bench_event *events;
+    size_t count;
+};
+
+#define WPM(v) {BENCH_EVENT_WPM, (v)}
+#define LAYER(v) {BENCH_EVENT_LAYER, (v)}
+#define PROFILE(v) {BENCH_EVENT_PROFILE, (v)}
+#define BATTERY(v) {BENCH_EVENT_BATTERY, (v)}
+#define CONNECTION(v) {BENCH_EVENT_CONNECTION, (v)}
+
+static const struct bench_event battery_events[] = {
+    BATTERY(100), BATTERY(99), BATTERY(98), BATTERY(95), BATTERY(90), BATTERY(81),
+    BATTERY(75),  BATTERY(60), BATTERY(42), BATTERY(30), BATTERY(18), BATTERY(5),
+};
+
+#define SCRIPT(name) {#name, name##_events, ARRAY_SIZE(name##_events)}
+
+#if !IS_ENABLED(CONFIG_ZMK_SPLIT) || IS_ENABLED(CONFIG_ZMK_SPLIT_ROLE_CENTRAL)
+static const struct bench_event wpm_events[] = {
+    WPM(0),  WPM(12), WPM(25), WPM(38), WPM(47), WPM(55), WPM(61), WPM(64), WPM(66),
+    WPM(66), WPM(63), WPM(68), WPM(72), WPM(70), WPM(65), WPM(58), WPM(60), WPM(62),
+    WPM(71), WPM(80), WPM(77), WPM(69), WPM(52), WPM(40), WPM(31), WPM(20), WPM(8),
+    WPM(0),  WPM(0),  WPM(0),  WPM(15), WPM(33), WPM(48), WPM(59), WPM(61), WPM(61),
+};
+
+static const struct bench_event layer_events[] = {
+    LAYER(1), LAYER(0), LAYER(2), LAYER(0), LAYER(1), LAYER(3), LAYER(1), LAYER(0),
+    LAYER(1), LAYER(0), LAYER(2), LAYER(0), LAYER(1), LAYER(3), LAYER(1), LAYER(0),
+};
+
+static const struct bench_event profile_events[] = {
+    PROFILE(1), PROFILE(2), PROFILE(3), PROFILE(4), PROFILE(0),
+    PROFILE(1), PROFILE(0), PROFILE(4), PROFILE(3), PROFILE(0),
+};
+
+static const struct bench_event mixed_events[] = {
+    WPM(40),    LAYER(1),   WPM(52),    WPM(61),    BATTERY(80), LAYER(0),   WPM(64),
+    PROFILE(1), WPM(58),    WPM(47),    LAYER(2),   WPM(30),     PROFILE(0), BATTERY(79),
+    WPM(22),    LAYER(0),   WPM(35),    WPM(50),    WPM(66),     LAYER(1),   WPM(71),
+};
+
+static const struct bench_script scripts[] = {
+    SCRIPT(wpm), SCRIPT(layer), SCRIPT(profile), SCRIPT(battery), SCRIPT(mixed),
+};
+#else
+static const struct bench_event connection_events[] = {
+    CONNECTION(1), CONNECTION(0), CONNECTION(1), CONNECTION(0),
+    CONNECTION(1), CONNECTION(0), CONNECTION(1), CONNECTION(0),
+};
+
+static const struct bench_event peripheral_events[] = {
+    CONNECTION(1), BATTERY(90), BATTERY(89), CONNECTION(0), BATTERY(88), CONNECTION(1),
+    BATTERY(87),   BATTERY(85), CONNECTION(0), CONNECTION(1), BATTERY(84), BATTERY(80),
+};
+
+static const struct bench_script scripts[] = {
+    SCRIPT(battery),
+    SCRIPT(connection),
+    SCRIPT(peripheral),
+};
+#endif
+
+static struct {
+    bool recording;
+    uint32_t bytes;
+} bench;
+
+void bench_flushed(uint32_t bytes) {
+    if (bench.recording) {
+        bench.bytes += bytes;
+    }
+}
+
+static void bench_script_run(const struct bench_script *script) {
+    struct display_flush_stats flushed = {};
+
+    memset(&bench, 0, sizeof(bench));
+    profile_reset();
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_LINE_FLUSH)
+    display_flush_reset_stats();
+#endif
+    bench.recording = true;
+
+    for (size_t i = 0; i < script->count; i++) {
+        zmk_widget_status_bench_apply(&script->events[i]);
+        zmk_widget_status_bench_render();
+        lv_refr_now(NULL);
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_LINE_FLUSH)
+        display_flush_sync();
+#endif
+    }
+
+    bench.recording = false;
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_LINE_FLUSH)
+    display_flush_get_stats(&flushed);
+#endif
+
+    struct profile_counter c;
+    for (int slot = 0; slot < PROFILE_SLOT_COUNT; slot++) {
+        profile_get(slot, &c);
+        printk("lpm_bench,slot,%s,%s,%u,%u,%u\n", script->name, profile_slot_name(slot), c.calls,
+               (uint32_t)profile_cycles_to_us(c.cycles),
+               (uint32_t)profile_cycles_to_us(c.max_cycles));
+    }
+    profile_get(PROFILE_FRAME, &c);
+    printk("lpm_bench,total,%s,%u,%u,%u,%u\n", script->name, c.calls, bench.bytes, flushed.lines,
+           flushed.bytes);
+}
+
+static void bench_work_cb(struct k_work *work) {
+    for (int i = 0; i < ARRAY_SIZE(scripts); i++) {
+        bench_script_run(&scripts[i]);
+    }
+}
+
+static K_WORK_DELAYABLE_DEFINE(bench_work, bench_work_cb);
+
+// Runs on the display work queue, like every other widget update
+void bench_run(void) {
+    k_work_schedule_for_queue(zmk_display_work_q(), &bench_work, BENCH_START_DELAY);
+}
@@ -0,0 +1,39 @@
+/*
+ *
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <zephyr/kernel.h>
+
+enum bench_event_type {
+    BENCH_EVENT_WPM,
+    BENCH_EVENT_LAYER,
+    BENCH_EVENT_PROFILE,
+    BENCH_EVENT_BATTERY,
+    BENCH_EVENT_CONNECTION,
+};
+
+struct bench_event {
+    uint8_t type;
+    uint8_t value;
+};
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_BENCH)
+
+void bench_run(void);
+void bench_flushed(uint32_t bytes);
+
+// Provided by the status widget of the central or the peripheral
+void zmk_widget_status_bench_apply(const struct bench_event *event);
+void zmk_widget_status_bench_render(void);
+
+#else
+
+static inline void bench_run(void) {}
+static inline void bench_flushed(uint32_t bytes) {}
+
+#endif /* IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_BENCH) */
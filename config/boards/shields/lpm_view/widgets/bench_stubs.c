@@ -0,0 +1,48 @@
+/*
+ *
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/display.h>
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+
+#include <zmk/battery.h>
+#include <zmk/event_manager.h>
+#include <zmk/events/battery_state_changed.h>
+
+// Stand-ins for the ZMK state native_sim has no hardware for, so the status
+// widgets build and run there for the render benchmark. The getters report a
+// fixed state; the benchmark drives the widgets with its own events.
+
+#if !IS_ENABLED(CONFIG_ZMK_BATTERY_REPORTING)
+uint8_t zmk_battery_state_of_charge(void) { return 100; }
+
+ZMK_EVENT_IMPL(zmk_battery_state_changed);
+#endif
+
+#if IS_ENABLED(CONFIG_ZMK_SPLIT) && !IS_ENABLED(CONFIG_ZMK_SPLIT_ROLE_CENTRAL) &&                 \
+    !IS_ENABLED(CONFIG_ZMK_SPLIT_BLE)
+#include <zmk/split/bluetooth/peripheral.h>
+#include <zmk/events/split_peripheral_status_changed.h>
+
+bool zmk_split_bt_peripheral_is_connected(void) { return false; }
+
+ZMK_EVENT_IMPL(zmk_split_peripheral_status_changed);
+#endif
+
+// The dummy display starts out in a 32 bpp format LVGL is not built for. The
+// panel it stands in for takes MONO10, which LVGL must see before it starts.
+static int bench_display_init(void) {
+    const struct device *display = DEVICE_DT_GET(DT_CHOSEN(zephyr_display));
+
+    if (!device_is_ready(display)) {
+        return -ENODEV;
+    }
+    return display_set_pixel_format(display, PIXEL_FORMAT_MONO10);
+}
+
+SYS_INIT(bench_display_init, POST_KERNEL, CONFIG_APPLICATION_INIT_PRIORITY);
@@ -0,0 +1,119 @@
+/*
+ *
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <lvgl.h>
+
+#include "frame_arena.h"
+
+static uint8_t arena_buf[CONFIG_NICE_VIEW_WIDGET_FRAME_ARENA_SIZE] __aligned(LV_DRAW_BUF_ALIGN);
+
+static struct k_spinlock lock;
+static struct {
+    uint32_t top;
+    uint32_t live;
+    struct frame_arena_stats stats;
+} arena;
+
+// LVGL's own handlers, used for whatever does not fit
+static lv_draw_buf_malloc_cb heap_malloc;
+static lv_draw_buf_free_cb heap_free;
+
+static bool arena_owns(const void *ptr) {
+    return (const uint8_t *)ptr >= arena_buf && (const uint8_t *)ptr < arena_buf + sizeof(arena_buf);
+}
+
+// Blocks are aligned for LVGL, so aligning the buffer start does not move it
+static void *arena_malloc(size_t size, lv_color_format_t color_format) {
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    const uint32_t start = ROUND_UP(arena.top, LV_DRAW_BUF_ALIGN);
+    void *ptr = NULL;
+
+    if (size <= sizeof(arena_buf) - start) {
+        ptr = arena_buf + start;
+        arena.top = start + size;
+        arena.live++;
+        arena.stats.high_water = MAX(arena.stats.high_water, arena.top);
+    } else {
+        arena.stats.overflows++;
+    }
+
+    k_spin_unlock(&lock, key);
+
+    return ptr != NULL ? ptr : heap_malloc(size, color_format);
+}
+
+static void arena_free(void *ptr) {
+    if (!arena_owns(ptr)) {
+        heap_free(ptr);
+        return;
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    if (--arena.live == 0) {
+        arena.top = 0;
+    }
+    k_spin_unlock(&lock, key);
+}
+
+// Labels are rendered one at a time and reuse their glyph buffer for every
+// glyph, so the peak does not grow with the number of profiles drawn or the
+// length of the layer name: it is the buffers of the largest glyph, from a font
+// of up to `font_size` pixels. The callers check that against the arena size
+// with a BUILD_ASSERT.
+void frame_arena_init(int32_t font_size) {
+    lv_draw_buf_handlers_t *handlers = lv_draw_buf_get_font_handlers();
+
+    if (heap_malloc != NULL) {
+        return;
+    }
+
+    arena.stats.worst_case = FRAME_ARENA_WORST_CASE(font_size);
+
+    heap_malloc = handlers->buf_malloc_cb;
+    heap_free = handlers->buf_free_cb;
+    handlers->buf_malloc_cb = arena_malloc;
+    handlers->buf_free_cb = arena_free;
+}
+
+void frame_arena_end_frame(void) {
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    // Buffers still allocated are in use, so the arena can only start over
+    // once they are freed
+    if (arena.live == 0) {
+        arena.top = 0;
+    } else {
+        arena.stats.held_frames++;
+    }
+
+    k_spin_unlock(&lock, key);
+}
+
+void frame_arena_count_tasks(uint32_t count) {
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    arena.stats.heap_tasks += count;
+    k_spin_unlock(&lock, key);
+}
+
+void frame_arena_reset_stats(void) {
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    const uint32_t worst_case = arena.stats.worst_case;
+    memset(&arena.stats, 0, sizeof(arena.stats));
+    arena.stats.worst_case = worst_case;
+    arena.stats.high_water = arena.top;
+    k_spin_unlock(&lock, key);
+}
+
+void frame_arena_get_stats(struct frame_arena_stats *out) {
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    *out = arena.stats;
+    out->size = sizeof(arena_buf);
+    out->used = arena.top;
+    k_spin_unlock(&lock, key);
+}
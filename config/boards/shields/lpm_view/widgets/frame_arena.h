@@ -0,0 +1,60 @@
+/*
+ *
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <lvgl.h>
+#include <zephyr/kernel.h>
+
+// Bump allocator for the glyph buffers LVGL allocates while rendering text. It
+// rewinds whenever nothing is allocated from it, which happens after every
+// label, and at the end of each frame, so these buffers never reach the LVGL
+// heap. Requests that do not fit fall back to the heap and are counted.
+
+// LVGL may allocate a glyph buffer at up to twice the glyph height to avoid
+// reallocating it for taller glyphs later in the label, and allocates the
+// larger buffer before it frees the smaller one. Montserrat glyphs and the
+// FontAwesome symbols merged into it fit a square of 5/4 of the font size, so
+// the peak for fonts of up to `size` pixels is known at build time.
+#define FRAME_ARENA_GLYPH_BOX(size) DIV_ROUND_UP(5 * (size), 4)
+#define FRAME_ARENA_GLYPH_BUF_SIZE(size)                                                           \
+    (LV_DRAW_BUF_STRIDE(FRAME_ARENA_GLYPH_BOX(size), LV_COLOR_FORMAT_A8) * 2 *                     \
+         FRAME_ARENA_GLYPH_BOX(size) +                                                             \
+     LV_DRAW_BUF_ALIGN)
+#define FRAME_ARENA_WORST_CASE(size) (2 * FRAME_ARENA_GLYPH_BUF_SIZE(size))
+
+struct frame_arena_stats {
+    uint32_t size;
+    // Peak for the largest font in use, checked against the size at build time
+    uint32_t worst_case;
+    uint32_t used;
+    // Most bytes in use at once since boot or the last reset
+    uint32_t high_water;
+    // Allocations that did not fit and went to the LVGL heap instead
+    uint32_t overflows;
+    // Frames that ended with arena memory still allocated
+    uint32_t held_frames;
+    // LVGL draw tasks queued by the canvas_draw_* primitives. The arena does
+    // not cover them: each one is still allocated from the LVGL heap.
+    uint32_t heap_tasks;
+};
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_FRAME_ARENA)
+
+void frame_arena_init(int32_t font_size);
+void frame_arena_end_frame(void);
+void frame_arena_count_tasks(uint32_t count);
+void frame_arena_get_stats(struct frame_arena_stats *out);
+void frame_arena_reset_stats(void);
+
+#else
+
+static inline void frame_arena_init(int32_t font_size) {}
+static inline void frame_arena_end_frame(void) {}
+static inline void frame_arena_count_tasks(uint32_t count) {}
+
+#endif /* IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_FRAME_ARENA) */
@@ -0,0 +1,158 @@
+/*
+ *
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/shell/shell.h>
+#include <lvgl.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include "latency.h"
+#include "listener.h"
+
+// An event is stamped when a widget listener receives it. The stamp moves on
+// once a frame has rendered that kind of change, and the latency is recorded
+// when the next flush completes. Only the oldest unrendered event of each kind
+// is tracked, so a burst counts from its first event.
+
+static struct k_spinlock lock;
+static uint32_t pending;
+static uint32_t pending_stamp[LATENCY_EVENT_COUNT];
+static uint32_t rendered;
+static uint32_t rendered_stamp[LATENCY_EVENT_COUNT];
+static struct latency_histogram histograms[LATENCY_EVENT_COUNT];
+
+void latency_event(enum latency_event event) {
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    if (!(pending & BIT(event))) {
+        pending_stamp[event] = k_cycle_get_32();
+        pending |= BIT(event);
+    }
+
+    k_spin_unlock(&lock, key);
+}
+
+void latency_rendered(uint32_t events) {
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    for (int i = 0; i < LATENCY_EVENT_COUNT; i++) {
+        if ((pending & events & BIT(i)) && !(rendered & BIT(i))) {
+            rendered_stamp[i] = pending_stamp[i];
+            rendered |= BIT(i);
+        }
+    }
+    pending &= ~events;
+
+    k_spin_unlock(&lock, key);
+}
+
+// Forgets pending events that will not be drawn until much later, such as
+// those arriving while the display is paused
+void latency_discard(uint32_t events) {
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    pending &= ~events;
+    k_spin_unlock(&lock, key);
+}
+
+static void record(struct latency_histogram *histogram, uint32_t cycles) {
+    uint32_t us = k_cyc_to_us_floor32(cycles);
+
+    histogram->count++;
+    histogram->total_us += us;
+    histogram->max_us = MAX(histogram->max_us, us);
+    histogram->buckets[MIN(find_msb_set(us / 1000), LATENCY_BUCKETS - 1)]++;
+}
+
+void latency_flushed(void) {
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    uint32_t now = k_cycle_get_32();
+
+    for (int i = 0; i < LATENCY_EVENT_COUNT; i++) {
+        if (rendered & BIT(i)) {
+            record(&histograms[i], now - rendered_stamp[i]);
+        }
+    }
+    rendered = 0;
+
+    k_spin_unlock(&lock, key);
+}
+
+void latency_get(enum latency_event event, struct latency_histogram *out) {
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    *out = histograms[event];
+    k_spin_unlock(&lock, key);
+}
+
+void latency_reset(void) {
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    memset(histograms, 0, sizeof(histograms));
+    k_spin_unlock(&lock, key);
+}
+
+#if !IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_LINE_FLUSH)
+// Without the line flush, the end of an LVGL refresh is the end of the flush
+static void refresh_ready_cb(lv_event_t *e) { latency_flushed(); }
+#endif
+
+#if CONFIG_NICE_VIEW_WIDGET_LATENCY_LOG_INTERVAL > 0
+static void log_work_cb(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(log_work, log_work_cb);
+
+static void log_work_cb(struct k_work *work) {
+    struct latency_histogram h;
+
+    for (int i = 0; i < LATENCY_EVENT_COUNT; i++) {
+        latency_get(i, &h);
+        if (h.count > 0) {
+            LOG_INF("display latency %s: n=%u avg=%uus max=%uus", listener_event_name(i),
+                    h.count, (uint32_t)(h.total_us / h.count), h.max_us);
+        }
+    }
+
+    k_work_schedule(&log_work, K_SECONDS(CONFIG_NICE_VIEW_WIDGET_LATENCY_LOG_INTERVAL));
+}
+#endif
+
+void latency_init(void) {
+#if !IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_LINE_FLUSH)
+    lv_display_add_event_cb(lv_display_get_default(), refresh_ready_cb, LV_EVENT_REFR_READY, NULL);
+#endif
+#if CONFIG_NICE_VIEW_WIDGET_LATENCY_LOG_INTERVAL > 0
+    k_work_schedule(&log_work, K_SECONDS(CONFIG_NICE_VIEW_WIDGET_LATENCY_LOG_INTERVAL));
+#endif
+}
+
+#if IS_ENABLED(CONFIG_SHELL)
+static int cmd_latency(const struct shell *sh, size_t argc, char **argv) {
+    struct latency_histogram h;
+
+    if (argc > 1 && strcmp(argv[1], "reset") == 0) {
+        latency_reset();
+        return 0;
+    }
+
+    for (int i = 0; i < LATENCY_EVENT_COUNT; i++) {
+        latency_get(i, &h);
+        shell_print(sh, "%s: n=%u avg=%uus max=%uus", listener_event_name(i), h.count,
+                    h.count ? (uint32_t)(h.total_us / h.count) : 0, h.max_us);
+        for (int b = 0; b < LATENCY_BUCKETS; b++) {
+            if (h.buckets[b] > 0) {
+                shell_print(sh, "  %s%4u ms: %u", b == LATENCY_BUCKETS - 1 ? ">=" : "< ",
+                            b == LATENCY_BUCKETS - 1 ? BIT(b - 1) : BIT(b), h.buckets[b]);
+            }
+        }
+    }
+
+    return 0;
+}
+
+SHELL_CMD_ARG_REGISTER(lpm_latency, NULL, "Print status display latency histograms [reset]",
+                       cmd_latency, 1, 1);
+#endif /* IS_ENABLED(CONFIG_SHELL) */
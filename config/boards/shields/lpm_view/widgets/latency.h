@@ -0,0 +1,50 @@
+/*
+ *
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <zephyr/kernel.h>
+
+enum latency_event {
+    LATENCY_LAYER,
+    LATENCY_WPM,
+    LATENCY_BATTERY,
+    LATENCY_OUTPUT,
+    LATENCY_CONNECTION,
+    LATENCY_EVENT_COUNT,
+};
+
+// Bucket 0 holds latencies below 1 ms, bucket n those from 2^(n-1) ms up to
+// 2^n ms, and the last bucket everything above
+#define LATENCY_BUCKETS 12
+
+struct latency_histogram {
+    uint32_t count;
+    uint32_t max_us;
+    uint64_t total_us;
+    uint16_t buckets[LATENCY_BUCKETS];
+};
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_LATENCY)
+
+void latency_init(void);
+void latency_event(enum latency_event event);
+void latency_rendered(uint32_t events);
+void latency_discard(uint32_t events);
+void latency_flushed(void);
+void latency_get(enum latency_event event, struct latency_histogram *out);
+void latency_reset(void);
+
+#else
+
+static inline void latency_init(void) {}
+static inline void latency_event(enum latency_event event) {}
+static inline void latency_rendered(uint32_t events) {}
+static inline void latency_discard(uint32_t events) {}
+static inline void latency_flushed(void) {}
+
+#endif /* IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_LATENCY) */
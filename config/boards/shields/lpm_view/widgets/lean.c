@@ -0,0 +1,258 @@
+/*
+ *
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/sys/util.h>
+
+#include "lean.h"
+#include "mono.h"
+
+// Drawing primitives for the lean renderer. Everything is plain integer code
+// writing straight into the packed framebuffer: no objects, draw tasks, heap
+// or intermediate 8 bpp buffers.
+
+// Classic 5x7 font for printable ASCII, one byte per column with the top row in
+// bit 0
+static const uint8_t font[][LEAN_FONT_WIDTH] = {
+    {0x00, 0x00, 0x00, 0x00, 0x00}, {0x00, 0x00, 0x5f, 0x00, 0x00}, // ' ' !
+    {0x00, 0x07, 0x00, 0x07, 0x00}, {0x14, 0x7f, 0x14, 0x7f, 0x14}, // " #
+    {0x24, 0x2a, 0x7f, 0x2a, 0x12}, {0x23, 0x13, 0x08, 0x64, 0x62}, // $ %
+    {0x36, 0x49, 0x55, 0x22, 0x50}, {0x00, 0x05, 0x03, 0x00, 0x00}, // & '
+    {0x00, 0x1c, 0x22, 0x41, 0x00}, {0x00, 0x41, 0x22, 0x1c, 0x00}, // ( )
+    {0x14, 0x08, 0x3e, 0x08, 0x14}, {0x08, 0x08, 0x3e, 0x08, 0x08}, // * +
+    {0x00, 0x50, 0x30, 0x00, 0x00}, {0x08, 0x08, 0x08, 0x08, 0x08}, // , -
+    {0x00, 0x60, 0x60, 0x00, 0x00}, {0x20, 0x10, 0x08, 0x04, 0x02}, // . /
+    {0x3e, 0x51, 0x49, 0x45, 0x3e}, {0x00, 0x42, 0x7f, 0x40, 0x00}, // 0 1
+    {0x42, 0x61, 0x51, 0x49, 0x46}, {0x21, 0x41, 0x45, 0x4b, 0x31}, // 2 3
+    {0x18, 0x14, 0x12, 0x7f, 0x10}, {0x27, 0x45, 0x45, 0x45, 0x39}, // 4 5
+    {0x3c, 0x4a, 0x49, 0x49, 0x30}, {0x01, 0x71, 0x09, 0x05, 0x03}, // 6 7
+    {0x36, 0x49, 0x49, 0x49, 0x36}, {0x06, 0x49, 0x49, 0x29, 0x1e}, // 8 9
+    {0x00, 0x36, 0x36, 0x00, 0x00}, {0x00, 0x56, 0x36, 0x00, 0x00}, // : ;
+    {0x08, 0x14, 0x22, 0x41, 0x00}, {0x14, 0x14, 0x14, 0x14, 0x14}, // < =
+    {0x00, 0x41, 0x22, 0x14, 0x08}, {0x02, 0x01, 0x51, 0x09, 0x06}, // > ?
+    {0x32, 0x49, 0x79, 0x41, 0x3e}, {0x7e, 0x11, 0x11, 0x11, 0x7e}, // @ A
+    {0x7f, 0x49, 0x49, 0x49, 0x36}, {0x3e, 0x41, 0x41, 0x41, 0x22}, // B C
+    {0x7f, 0x41, 0x41, 0x22, 0x1c}, {0x7f, 0x49, 0x49, 0x49, 0x41}, // D E
+    {0x7f, 0x09, 0x09, 0x09, 0x01}, {0x3e, 0x41, 0x49, 0x49, 0x7a}, // F G
+    {0x7f, 0x08, 0x08, 0x08, 0x7f}, {0x00, 0x41, 0x7f, 0x41, 0x00}, // H I
+    {0x20, 0x40, 0x41, 0x3f, 0x01}, {0x7f, 0x08, 0x14, 0x22, 0x41}, // J K
+    {0x7f, 0x40, 0x40, 0x40, 0x40}, {0x7f, 0x02, 0x0c, 0x02, 0x7f}, // L M
+    {0x7f, 0x04, 0x08, 0x10, 0x7f}, {0x3e, 0x41, 0x41, 0x41, 0x3e}, // N O
+    {0x7f, 0x09, 0x09, 0x09, 0x06}, {0x3e, 0x41, 0x51, 0x21, 0x5e}, // P Q
+    {0x7f, 0x09, 0x19, 0x29, 0x46}, {0x46, 0x49, 0x49, 0x49, 0x31}, // R S
+    {0x01, 0x01, 0x7f, 0x01, 0x01}, {0x3f, 0x40, 0x40, 0x40, 0x3f}, // T U
+    {0x1f, 0x20, 0x40, 0x20, 0x1f}, {0x3f, 0x40, 0x38, 0x40, 0x3f}, // V W
+    {0x63, 0x14, 0x08, 0x14, 0x63}, {0x07, 0x08, 0x70, 0x08, 0x07}, // X Y
+    {0x61, 0x51, 0x49, 0x45, 0x43}, {0x00, 0x7f, 0x41, 0x41, 0x00}, // Z [
+    {0x02, 0x04, 0x08, 0x10, 0x20}, {0x00, 0x41, 0x41, 0x7f, 0x00}, // '\' ]
+    {0x04, 0x02, 0x01, 0x02, 0x04}, {0x40, 0x40, 0x40, 0x40, 0x40}, // ^ _
+    {0x00, 0x01, 0x02, 0x04, 0x00}, {0x20, 0x54, 0x54, 0x54, 0x78}, // ` a
+    {0x7f, 0x48, 0x44, 0x44, 0x38}, {0x38, 0x44, 0x44, 0x44, 0x20}, // b c
+    {0x38, 0x44, 0x44, 0x48, 0x7f}, {0x38, 0x54, 0x54, 0x54, 0x18}, // d e
+    {0x08, 0x7e, 0x09, 0x01, 0x02}, {0x0c, 0x52, 0x52, 0x52, 0x3e}, // f g
+    {0x7f, 0x08, 0x04, 0x04, 0x78}, {0x00, 0x44, 0x7d, 0x40, 0x00}, // h i
+    {0x20, 0x40, 0x44, 0x3d, 0x00}, {0x7f, 0x10, 0x28, 0x44, 0x00}, // j k
+    {0x00, 0x41, 0x7f, 0x40, 0x00}, {0x7c, 0x04, 0x18, 0x04, 0x78}, // l m
+    {0x7c, 0x08, 0x04, 0x04, 0x78}, {0x38, 0x44, 0x44, 0x44, 0x38}, // n o
+    {0x7c, 0x14, 0x14, 0x14, 0x08}, {0x08, 0x14, 0x14, 0x18, 0x7c}, // p q
+    {0x7c, 0x08, 0x04, 0x04, 0x08}, {0x48, 0x54, 0x54, 0x54, 0x20}, // r s
+    {0x04, 0x3f, 0x44, 0x40, 0x20}, {0x3c, 0x40, 0x40, 0x20, 0x7c}, // t u
+    {0x1c, 0x20, 0x40, 0x20, 0x1c}, {0x3c, 0x40, 0x30, 0x40, 0x3c}, // v w
+    {0x44, 0x28, 0x10, 0x28, 0x44}, {0x0c, 0x50, 0x50, 0x50, 0x3c}, // x y
+    {0x44, 0x64, 0x54, 0x4c, 0x44}, {0x00, 0x08, 0x36, 0x41, 0x00}, // z {
+    {0x00, 0x00, 0x7f, 0x00, 0x00}, {0x00, 0x41, 0x36, 0x08, 0x00}, // | }
+    {0x08, 0x04, 0x08, 0x10, 0x08},                                  // ~
+};
+
+#define FONT_FIRST ' '
+#define FONT_LAST '~'
+#define FONT_FALLBACK '?'
+
+// Stand-ins for the LVGL symbols of the output indicator, drawn at about the
+// size of the 16 px symbol font
+static const uint16_t usb_rows[] = {
+    0x0180, 0x03c0, 0x07e0, 0x018e, 0x318e, 0x798e, 0x7984, 0x3184,
+    0x118c, 0x1998, 0x0db0, 0x07e0, 0x0180, 0x0180, 0x03c0, 0x03c0,
+};
+static const uint16_t wifi_rows[] = {
+    0x0ff0, 0x3ffc, 0x781e, 0xe187, 0xcff3, 0x1e78,
+    0x381c, 0x07e0, 0x0ff0, 0x0180, 0x03c0, 0x0180,
+};
+static const uint16_t close_rows[] = {
+    0x6018, 0xf03c, 0x7878, 0x3cf0, 0x1fe0, 0x0fc0,
+    0x0fc0, 0x1fe0, 0x3cf0, 0x7878, 0xf03c, 0x6018,
+};
+static const uint16_t settings_rows[] = {
+    0x0300, 0x2790, 0x7ff8, 0x3ff0, 0x3cf0, 0x7878, 0xf87c,
+    0xf87c, 0x7878, 0x3cf0, 0x3ff0, 0x7ff8, 0x2790, 0x0300,
+};
+
+#define ICON(rows_, w_) {.w = (w_), .h = ARRAY_SIZE(rows_), .rows = (rows_)}
+
+const struct lean_icon lean_icon_usb = ICON(usb_rows, 16);
+const struct lean_icon lean_icon_wifi = ICON(wifi_rows, 16);
+const struct lean_icon lean_icon_close = ICON(close_rows, 14);
+const struct lean_icon lean_icon_settings = ICON(settings_rows, 14);
+
+void lean_rect_intersect(struct lean_rect *dst, const struct lean_rect *src) {
+    dst->x1 = MAX(dst->x1, src->x1);
+    dst->y1 = MAX(dst->y1, src->y1);
+    dst->x2 = MIN(dst->x2, src->x2);
+    dst->y2 = MIN(dst->y2, src->y2);
+}
+
+static inline void put_pixel(uint8_t (*fb)[LEAN_STRIDE], int16_t x, int16_t y, bool color) {
+    uint8_t *byte = &fb[y][x / 8];
+    const uint8_t mask = 0x80 >> (x % 8);
+
+    *byte = color ? (*byte | mask) : (*byte & ~mask);
+}
+
+static inline void view_pixel(const struct lean_view *view, int16_t x, int16_t y, bool color) {
+    if (x < view->clip.x1 || x > view->clip.x2 || y < view->clip.y1 || y > view->clip.y2) {
+        return;
+    }
+
+    put_pixel(view->fb, view->ox + y, view->oy + LEAN_CANVAS_SIZE - 1 - x, color);
+}
+
+void lean_fill_panel(lean_fb_t fb, const struct lean_rect *rect, bool color) {
+    const struct lean_rect panel = {0, 0, LEAN_WIDTH - 1, LEAN_HEIGHT - 1};
+    struct lean_rect r = *rect;
+
+    lean_rect_intersect(&r, &panel);
+    if (lean_rect_is_empty(&r)) {
+        return;
+    }
+
+    mono_fill_rect(&fb[0][0], LEAN_STRIDE, r.x1, r.y1, r.x2 - r.x1 + 1, r.y2 - r.y1 + 1, color);
+}
+
+// Canvas rectangles stay rectangles after rotation, so they are filled on the
+// panel directly
+void lean_fill_rect(const struct lean_view *view, int16_t x, int16_t y, int16_t w, int16_t h,
+                    bool color) {
+    struct lean_rect r = {x, y, x + w - 1, y + h - 1};
+
+    lean_rect_intersect(&r, &view->clip);
+    if (lean_rect_is_empty(&r)) {
+        return;
+    }
+
+    const struct lean_rect panel = {
+        .x1 = view->ox + r.y1,
+        .y1 = view->oy + LEAN_CANVAS_SIZE - 1 - r.x2,
+        .x2 = view->ox + r.y2,
+        .y2 = view->oy + LEAN_CANVAS_SIZE - 1 - r.x1,
+    };
+    lean_fill_panel(view->fb, &panel, color);
+}
+
+// One pixel wide Bresenham line, both end points included
+void lean_draw_line(const struct lean_view *view, int16_t x1, int16_t y1, int16_t x2, int16_t y2,
+                    bool color) {
+    const int16_t dx = abs(x2 - x1);
+    const int16_t dy = -abs(y2 - y1);
+    const int16_t sx = x1 < x2 ? 1 : -1;
+    const int16_t sy = y1 < y2 ? 1 : -1;
+    int16_t err = dx + dy;
+
+    while (true) {
+        view_pixel(view, x1, y1, color);
+        if (x1 == x2 && y1 == y2) {
+            break;
+        }
+
+        const int16_t e2 = 2 * err;
+        if (e2 >= dy) {
+            err += dy;
+            x1 += sx;
+        }
+        if (e2 <= dx) {
+            err += dx;
+            y1 += sy;
+        }
+    }
+}
+
+// Ring of `width` pixels inside radius `r`, a filled disc if `width` reaches the
+// centre. With `gaps`, it is split into 8 arcs with a 20 degree gap around every
+// multiple of 45 degrees, like the bonded profile rings. Gaps are found by
+// folding each pixel into the first octant and comparing the slope against
+// tan(10) and tan(35), so no trigonometry is needed.
+void lean_draw_ring(const struct lean_view *view, int16_t cx, int16_t cy, int16_t r, int16_t width,
+                    bool gaps, bool color) {
+    const int32_t outer = r * r;
+    const int32_t inner = width >= r ? -1 : (r - width) * (r - width);
+
+    for (int16_t dy = -r; dy <= r; dy++) {
+        for (int16_t dx = -r; dx <= r; dx++) {
+            const int32_t d2 = dx * dx + dy * dy;
+            if (d2 >= outer || d2 < inner) {
+                continue;
+            }
+
+            if (gaps) {
+                int32_t ax = abs(dx);
+                int32_t ay = abs(dy);
+                if (ay > ax) {
+                    int32_t t = ax;
+                    ax = ay;
+                    ay = t;
+                }
+                if (ay * 1000 < ax * 176 || ay * 1000 > ax * 700) {
+                    continue;
+                }
+            }
+
+            view_pixel(view, cx + dx, cy + dy, color);
+        }
+    }
+}
+
+// Draws the set pixels of `icon` in `color`; the others are left untouched
+void lean_draw_icon(const struct lean_view *view, int16_t x, int16_t y,
+                    const struct lean_icon *icon, bool color) {
+    for (int16_t row = 0; row < icon->h; row++) {
+        const uint16_t bits = icon->rows[row];
+        for (int16_t col = 0; col < icon->w; col++) {
+            if (bits & (0x8000 >> col)) {
+                view_pixel(view, x + col, y + row, color);
+            }
+        }
+    }
+}
+
+int16_t lean_text_width(const char *text, int16_t scale) {
+    const int16_t len = strlen(text);
+
+    return len == 0 ? 0 : (len * LEAN_FONT_ADVANCE - 1) * scale;
+}
+
+// Draws `text` with its top left corner at (x, y), every font pixel as a
+// `scale` x `scale` block
+void lean_draw_text(const struct lean_view *view, int16_t x, int16_t y, int16_t scale,
+                    const char *text, bool color) {
+    for (; *text != '\0'; text++, x += LEAN_FONT_ADVANCE * scale) {
+        const char c = (*text >= FONT_FIRST && *text <= FONT_LAST) ? *text : FONT_FALLBACK;
+        const uint8_t *glyph = font[c - FONT_FIRST];
+
+        for (int16_t col = 0; col < LEAN_FONT_WIDTH; col++) {
+            for (int16_t row = 0; row < LEAN_FONT_HEIGHT; row++) {
+                if (!(glyph[col] & BIT(row))) {
+                    continue;
+                }
+                if (scale == 1) {
+                    view_pixel(view, x + col, y + row, color);
+                } else {
+                    lean_fill_rect(view, x + col * scale, y + row * scale, scale, scale, color);
+                }
+            }
+        }
+    }
+}
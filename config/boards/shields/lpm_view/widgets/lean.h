@@ -0,0 +1,80 @@
+/*
+ *
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Packed 1 bpp framebuffer in panel orientation, MSB first, with the same bit
+// sense as LVGL's I1 rows: set bits are light pixels
+#define LEAN_WIDTH 144
+#define LEAN_HEIGHT 72
+#define LEAN_STRIDE (LEAN_WIDTH / 8)
+
+// Side of a logical (pre-rotation) canvas, as in the LVGL renderer
+#define LEAN_CANVAS_SIZE 68
+
+#define LEAN_FONT_WIDTH 5
+#define LEAN_FONT_HEIGHT 7
+#define LEAN_FONT_ADVANCE (LEAN_FONT_WIDTH + 1)
+
+typedef uint8_t lean_fb_t[LEAN_HEIGHT][LEAN_STRIDE];
+
+struct lean_rect {
+    int16_t x1;
+    int16_t y1;
+    int16_t x2;
+    int16_t y2;
+};
+
+// 1 bpp image of up to 16 columns, one row per entry, leftmost pixel in the top bit
+struct lean_icon {
+    uint8_t w;
+    uint8_t h;
+    const uint16_t *rows;
+};
+
+// A logical canvas placed on the panel. Drawing happens in canvas coordinates,
+// which are rotated so that canvas (x, y) lands on panel (ox + y, oy + 67 - x),
+// and is limited to `clip`, also in canvas coordinates.
+struct lean_view {
+    uint8_t (*fb)[LEAN_STRIDE];
+    int16_t ox;
+    int16_t oy;
+    struct lean_rect clip;
+};
+
+extern const struct lean_icon lean_icon_usb;
+extern const struct lean_icon lean_icon_wifi;
+extern const struct lean_icon lean_icon_close;
+extern const struct lean_icon lean_icon_settings;
+
+static inline bool lean_rect_is_empty(const struct lean_rect *r) {
+    return r->x1 > r->x2 || r->y1 > r->y2;
+}
+
+void lean_rect_intersect(struct lean_rect *dst, const struct lean_rect *src);
+void lean_fill_panel(lean_fb_t fb, const struct lean_rect *rect, bool color);
+void lean_fill_rect(const struct lean_view *view, int16_t x, int16_t y, int16_t w, int16_t h,
+                    bool color);
+void lean_draw_line(const struct lean_view *view, int16_t x1, int16_t y1, int16_t x2, int16_t y2,
+                    bool color);
+void lean_draw_ring(const struct lean_view *view, int16_t cx, int16_t cy, int16_t r, int16_t width,
+                    bool gaps, bool color);
+void lean_draw_icon(const struct lean_view *view, int16_t x, int16_t y,
+                    const struct lean_icon *icon, bool color);
+int16_t lean_text_width(const char *text, int16_t scale);
+void lean_draw_text(const struct lean_view *view, int16_t x, int16_t y, int16_t scale,
+                    const char *text, bool color);
+
+struct status_state;
+
+// Renders the parts of the status screen selected by `dirty` (STATUS_DIRTY_*) into
+// `fb`. Returns false if nothing was drawn, otherwise the panel rows it touched.
+bool lean_status_render(lean_fb_t fb, const struct status_state *state, uint32_t dirty,
+                        int16_t *y1, int16_t *y2);
@@ -0,0 +1,283 @@
+/*
+ *
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+
+#include "lean.h"
+#include "util.h"
+#include "profile.h"
+
+// The status screen of status.c, drawn with the lean primitives. The layout,
+// coordinates and canvas placement are the same; the LVGL fonts and symbols
+// are replaced by the built-in 5x7 font and icons.
+
+#define LEAN_FOREGROUND IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_INVERTED)
+#define LEAN_BACKGROUND !LEAN_FOREGROUND
+
+// Canvases as the LVGL widget places them. Later canvases cover the earlier
+// ones, which leaves the top canvas 58 columns and the bottom one 14.
+static const struct lean_view top_view = {.ox = 0, .oy = 4, .clip = {0, 0, 67, 57}};
+static const struct lean_view middle_view = {.ox = 58, .oy = 0, .clip = {0, 0, 67, 67}};
+static const struct lean_view bottom_view = {.ox = 130, .oy = 0, .clip = {0, 0, 67, 13}};
+
+// Panel areas no canvas covers, cleared with the first full frame
+static const struct lean_rect uncovered[] = {
+    {0, 0, 57, 3},
+    {58, 68, 143, 71},
+    {126, 0, 129, 67},
+};
+
+// The LVGL renderer's charging bolt
+static const struct lean_icon bolt_icon = {.w = BOLT_W, .h = BOLT_H, .rows = bolt_fill_rows};
+static const struct lean_icon bolt_outline_icon = {
+    .w = BOLT_W, .h = BOLT_H, .rows = bolt_outline_rows};
+
+static const struct lean_rect full_area = {0, 0, LEAN_CANVAS_SIZE - 1, LEAN_CANVAS_SIZE - 1};
+static const struct lean_rect top_battery_area = {0, 0, 33, 17};
+static const struct lean_rect top_output_area = {34, 0, LEAN_CANVAS_SIZE - 1, 19};
+static const struct lean_rect top_wpm_area = {0, 21, LEAN_CANVAS_SIZE - 1, 52};
+
+static const int16_t circle_offsets[NICEVIEW_PROFILE_COUNT][2] = {
+    {13, 13}, {55, 13}, {34, 34}, {13, 55}, {55, 55},
+};
+
+struct render_rows {
+    int16_t y1;
+    int16_t y2;
+};
+
+static void rect_join(struct lean_rect *dst, const struct lean_rect *src) {
+    if (lean_rect_is_empty(dst)) {
+        *dst = *src;
+        return;
+    }
+
+    dst->x1 = MIN(dst->x1, src->x1);
+    dst->y1 = MIN(dst->y1, src->y1);
+    dst->x2 = MAX(dst->x2, src->x2);
+    dst->y2 = MAX(dst->y2, src->y2);
+}
+
+static bool rect_overlaps(const struct lean_rect *a, const struct lean_rect *b) {
+    return a->x1 <= b->x2 && b->x1 <= a->x2 && a->y1 <= b->y2 && b->y1 <= a->y2;
+}
+
+static struct lean_rect profile_area(int i) {
+    return (struct lean_rect){circle_offsets[i][0] - 13, circle_offsets[i][1] - 13,
+                              circle_offsets[i][0] + 13, circle_offsets[i][1] + 13};
+}
+
+// Limits `view` to `area` of its canvas and clears it. Returns false if none of
+// the area is visible.
+static bool begin_area(struct lean_view *view, const struct lean_view *canvas, lean_fb_t fb,
+                       const struct lean_rect *area, struct render_rows *rows) {
+    *view = *canvas;
+    view->fb = fb;
+    lean_rect_intersect(&view->clip, area);
+    if (lean_rect_is_empty(&view->clip)) {
+        return false;
+    }
+
+    rows->y1 = MIN(rows->y1, view->oy + LEAN_CANVAS_SIZE - 1 - view->clip.x2);
+    rows->y2 = MAX(rows->y2, view->oy + LEAN_CANVAS_SIZE - 1 - view->clip.x1);
+
+    lean_fill_rect(view, view->clip.x1, view->clip.y1, view->clip.x2 - view->clip.x1 + 1,
+                   view->clip.y2 - view->clip.y1 + 1, LEAN_BACKGROUND);
+    return true;
+}
+
+static void draw_battery_gauge(const struct lean_view *view, const struct status_state *state) {
+    lean_fill_rect(view, 0, 2, 29, 12, LEAN_FOREGROUND);
+    lean_fill_rect(view, 1, 3, 27, 10, LEAN_BACKGROUND);
+    lean_fill_rect(view, 2, 4, battery_bar_width(state->battery), 8, LEAN_FOREGROUND);
+    lean_fill_rect(view, 30, 5, 3, 6, LEAN_FOREGROUND);
+    lean_fill_rect(view, 31, 6, 1, 4, LEAN_BACKGROUND);
+
+    if (state->charging) {
+        lean_draw_icon(view, BOLT_X, BOLT_Y, &bolt_outline_icon, LEAN_BACKGROUND);
+        lean_draw_icon(view, BOLT_X, BOLT_Y, &bolt_icon, LEAN_FOREGROUND);
+    }
+}
+
+static void draw_output_status(const struct lean_view *view, const struct status_state *state) {
+    const struct lean_icon *icon = NULL;
+
+    switch (state->selected_endpoint.transport) {
+    case ZMK_TRANSPORT_USB:
+        icon = &lean_icon_usb;
+        break;
+    case ZMK_TRANSPORT_BLE:
+        if (state->active_profile_bonded) {
+            icon = state->active_profile_connected ? &lean_icon_wifi : &lean_icon_close;
+        } else {
+            icon = &lean_icon_settings;
+        }
+        break;
+    }
+
+    if (icon != NULL) {
+        lean_draw_icon(view, LEAN_CANVAS_SIZE - 1 - icon->w, 1, icon, LEAN_FOREGROUND);
+    }
+}
+
+static void draw_wpm(const struct lean_view *view, const struct status_state *state) {
+    lean_fill_rect(view, 0, 21, 70, 32, LEAN_FOREGROUND);
+    lean_fill_rect(view, 1, 22, 66, 30, LEAN_BACKGROUND);
+
+    int16_t prev_x = 0;
+    int16_t prev_y = 0;
+    for (int i = 0; i < WPM_HISTORY; i++) {
+        uint8_t wpm = state->wpm[(state->wpm_head + i) % WPM_HISTORY];
+        int16_t x = 2 + i * WPM_STEP;
+        int16_t y = wpm_graph_y(wpm, state->wpm_min, state->wpm_max);
+
+        if (i > 0) {
+            lean_draw_line(view, prev_x, prev_y, x, y, LEAN_FOREGROUND);
+        }
+        prev_x = x;
+        prev_y = y;
+    }
+
+    char text[4];
+    snprintf(text, sizeof(text), "%d",
+             state->wpm[(state->wpm_head + WPM_HISTORY - 1) % WPM_HISTORY]);
+    lean_draw_text(view, 67 - lean_text_width(text, 1), 42, 1, text, LEAN_FOREGROUND);
+}
+
+static void draw_top(lean_fb_t fb, const struct status_state *state, uint32_t dirty,
+                     struct render_rows *rows) {
+    struct lean_rect area = {1, 1, 0, 0};
+    struct lean_view view;
+
+    if (dirty == STATUS_DIRTY_ALL) {
+        area = full_area;
+    }
+    if (dirty & STATUS_DIRTY_BATTERY) {
+        rect_join(&area, &top_battery_area);
+    }
+    if (dirty & STATUS_DIRTY_OUTPUT) {
+        rect_join(&area, &top_output_area);
+    }
+    if (dirty & STATUS_DIRTY_WPM) {
+        rect_join(&area, &top_wpm_area);
+    }
+    if (lean_rect_is_empty(&area) || !begin_area(&view, &top_view, fb, &area, rows)) {
+        return;
+    }
+
+    if (rect_overlaps(&area, &top_battery_area)) {
+        draw_battery_gauge(&view, state);
+    }
+    if (rect_overlaps(&area, &top_output_area)) {
+        draw_output_status(&view, state);
+    }
+    if (rect_overlaps(&area, &top_wpm_area)) {
+        draw_wpm(&view, state);
+    }
+}
+
+static void draw_profile(const struct lean_view *view, const struct status_state *state, int i) {
+    const int16_t cx = circle_offsets[i][0];
+    const int16_t cy = circle_offsets[i][1];
+    const bool selected = i == state->active_profile_index;
+
+    if (state->profiles_connected[i]) {
+        lean_draw_ring(view, cx, cy, 13, 2, false, LEAN_FOREGROUND);
+    } else if (state->profiles_bonded[i]) {
+        lean_draw_ring(view, cx, cy, 13, 2, true, LEAN_FOREGROUND);
+    }
+
+    if (selected) {
+        lean_draw_ring(view, cx, cy, 9, 9, false, LEAN_FOREGROUND);
+    }
+
+    const char label[2] = {'1' + i, '\0'};
+    lean_draw_text(view, cx - LEAN_FONT_WIDTH, cy - LEAN_FONT_HEIGHT, 2, label,
+                   selected ? LEAN_BACKGROUND : LEAN_FOREGROUND);
+}
+
+static void draw_middle(lean_fb_t fb, const struct status_state *state, uint32_t dirty,
+                        struct render_rows *rows) {
+    struct lean_rect area = {1, 1, 0, 0};
+    struct lean_view view;
+
+    if (dirty == STATUS_DIRTY_ALL) {
+        area = full_area;
+    }
+    for (int i = 0; i < NICEVIEW_PROFILE_COUNT; i++) {
+        if (dirty & STATUS_DIRTY_PROFILE(i)) {
+            struct lean_rect ring = profile_area(i);
+            rect_join(&area, &ring);
+        }
+    }
+    if (lean_rect_is_empty(&area) || !begin_area(&view, &middle_view, fb, &area, rows)) {
+        return;
+    }
+
+    // Neighbours whose bounding boxes reach into the area are drawn again too
+    for (int i = 0; i < NICEVIEW_PROFILE_COUNT; i++) {
+        struct lean_rect ring = profile_area(i);
+        if (rect_overlaps(&area, &ring)) {
+            draw_profile(&view, state, i);
+        }
+    }
+}
+
+static void draw_bottom(lean_fb_t fb, const struct status_state *state, uint32_t dirty,
+                        struct render_rows *rows) {
+    struct lean_view view;
+
+    if (!(dirty & STATUS_DIRTY_LAYER) || !begin_area(&view, &bottom_view, fb, &full_area, rows)) {
+        return;
+    }
+
+    char text[10];
+    const char *label = state->layer_label;
+    if (label == NULL || strlen(label) == 0) {
+        snprintf(text, sizeof(text), "LAYER %i", state->layer_index);
+        label = text;
+    }
+
+    // Short names are doubled in size to fill the visible strip
+    const int16_t scale = lean_text_width(label, 2) <= LEAN_CANVAS_SIZE ? 2 : 1;
+    const int16_t visible = bottom_view.clip.y2 + 1;
+
+    lean_draw_text(&view, (LEAN_CANVAS_SIZE - lean_text_width(label, scale)) / 2,
+                   (visible - LEAN_FONT_HEIGHT * scale) / 2, scale, label, LEAN_FOREGROUND);
+}
+
+bool lean_status_render(lean_fb_t fb, const struct status_state *state, uint32_t dirty,
+                        int16_t *y1, int16_t *y2) {
+    struct render_rows rows = {LEAN_HEIGHT, -1};
+
+    if (dirty == STATUS_DIRTY_ALL) {
+        for (int i = 0; i < ARRAY_SIZE(uncovered); i++) {
+            lean_fill_panel(fb, &uncovered[i], LEAN_BACKGROUND);
+        }
+        rows = (struct render_rows){0, LEAN_HEIGHT - 1};
+    }
+
+    profile_time_t start = profile_start();
+    draw_top(fb, state, dirty, &rows);
+    profile_stop(PROFILE_DRAW_TOP, start);
+    start = profile_start();
+    draw_middle(fb, state, dirty, &rows);
+    profile_stop(PROFILE_DRAW_MIDDLE, start);
+    start = profile_start();
+    draw_bottom(fb, state, dirty, &rows);
+    profile_stop(PROFILE_DRAW_BOTTOM, start);
+
+    if (rows.y1 > rows.y2) {
+        return false;
+    }
+
+    *y1 = rows.y1;
+    *y2 = rows.y2;
+    return true;
+}
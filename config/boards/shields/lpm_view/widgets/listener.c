@@ -0,0 +1,68 @@
+/*
+ *
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/shell/shell.h>
+
+#include "listener.h"
+
+static const char *const event_names[LATENCY_EVENT_COUNT] = {
+    [LATENCY_LAYER] = "layer",     [LATENCY_WPM] = "wpm",
+    [LATENCY_BATTERY] = "battery", [LATENCY_OUTPUT] = "output",
+    [LATENCY_CONNECTION] = "connection",
+};
+
+const char *listener_event_name(enum latency_event event) { return event_names[event]; }
+
+static struct k_spinlock lock;
+static struct listener_counter counters[LATENCY_EVENT_COUNT];
+
+void listener_received(enum latency_event event, bool discarded) {
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    counters[event].received++;
+    if (discarded) {
+        counters[event].discarded++;
+    }
+
+    k_spin_unlock(&lock, key);
+}
+
+void listener_get(enum latency_event event, struct listener_counter *out) {
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    *out = counters[event];
+    k_spin_unlock(&lock, key);
+}
+
+void listener_reset(void) {
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    memset(counters, 0, sizeof(counters));
+    k_spin_unlock(&lock, key);
+}
+
+#if IS_ENABLED(CONFIG_SHELL)
+static int cmd_events(const struct shell *sh, size_t argc, char **argv) {
+    struct listener_counter c;
+
+    if (argc > 1 && strcmp(argv[1], "reset") == 0) {
+        listener_reset();
+        return 0;
+    }
+
+    for (int i = 0; i < LATENCY_EVENT_COUNT; i++) {
+        listener_get(i, &c);
+        shell_print(sh, "%-10s received=%u discarded=%u", listener_event_name(i),
+                    c.received, c.discarded);
+    }
+
+    return 0;
+}
+
+SHELL_CMD_ARG_REGISTER(lpm_events, NULL, "Print status events received and discarded [reset]",
+                       cmd_events, 1, 1);
+#endif /* IS_ENABLED(CONFIG_SHELL) */
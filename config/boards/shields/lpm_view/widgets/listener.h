@@ -0,0 +1,137 @@
+/*
+ *
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <zephyr/kernel.h>
+#include <zmk/display.h>
+#include <zmk/event_manager.h>
+
+#include "latency.h"
+#include "util.h"
+
+struct listener_counter {
+    uint32_t received;
+    uint32_t discarded;
+};
+
+const char *listener_event_name(enum latency_event event);
+void listener_received(enum latency_event event, bool discarded);
+void listener_get(enum latency_event event, struct listener_counter *out);
+void listener_reset(void);
+
+// ZMK_DISPLAY_WIDGET_LISTENER with a filter that runs in the context of the
+// event, before any work is queued. `filter_func(prev, next)` compares the
+// state of the event with the last one passed on to `cb` and returns false if
+// it would not change what is shown; such events are dropped and counted. The
+// filter may also adjust `next`, for instance to round it to what is drawn.
+// Events passed on are stamped for the latency histograms of `event`.
+#define NICE_VIEW_WIDGET_LISTENER(listener, state_type, cb, state_func, filter_func, event)        \
+    K_MUTEX_DEFINE(listener##_mutex);                                                              \
+    static state_type __##listener##_state;                                                        \
+                                                                                                   \
+    static void listener##_refresh_state(struct k_work *work) {                                    \
+        k_mutex_lock(&listener##_mutex, K_FOREVER);                                                \
+        cb(__##listener##_state);                                                                  \
+        k_mutex_unlock(&listener##_mutex);                                                         \
+    }                                                                                              \
+                                                                                                   \
+    static K_WORK_DEFINE(listener##_work, listener##_refresh_state);                               \
+                                                                                                   \
+    static void listener##_init(void) {                                                            \
+        k_mutex_lock(&listener##_mutex, K_FOREVER);                                                \
+        __##listener##_state = state_func(NULL);                                                   \
+        k_mutex_unlock(&listener##_mutex);                                                         \
+        listener##_refresh_state(&listener##_work);                                                \
+    }                                                                                              \
+                                                                                                   \
+    static int listener##_cb(const zmk_event_t *eh) {                                              \
+        if (!zmk_display_is_initialized()) {                                                       \
+            return ZMK_EV_EVENT_BUBBLE;                                                            \
+        }                                                                                          \
+                                                                                                   \
+        k_mutex_lock(&listener##_mutex, K_FOREVER);                                                \
+        state_type state = state_func(eh);                                                         \
+        const bool visible = filter_func(&__##listener##_state, &state);                           \
+        if (visible) {                                                                             \
+            __##listener##_state = state;                                                          \
+        }                                                                                          \
+        k_mutex_unlock(&listener##_mutex);                                                         \
+                                                                                                   \
+        listener_received(event, !visible);                                                        \
+        if (visible) {                                                                             \
+            latency_event(event);                                                                  \
+            k_work_submit_to_queue(zmk_display_work_q(), &listener##_work);                        \
+        }                                                                                          \
+        return ZMK_EV_EVENT_BUBBLE;                                                                \
+    }                                                                                              \
+                                                                                                   \
+    ZMK_LISTENER(listener, listener##_cb);
+
+// NICE_VIEW_WIDGET_LISTENER without the hop onto the display work queue. The
+// state is taken from the event first, then filtered and, if visible, passed to
+// `publish` in the context of the event, under a spinlock that keeps the
+// publications of one listener in order. `publish` must not block; it records
+// the state and returns what changed, which is handed to `notify` once the lock
+// is released.
+#define NICE_VIEW_WIDGET_PUBLISHER(listener, state_type, publish, notify, state_func, filter_func, \
+                                   event)                                                          \
+    static struct k_spinlock listener##_lock;                                                      \
+    static state_type __##listener##_state;                                                        \
+                                                                                                   \
+    static void listener##_init(void) {                                                            \
+        state_type state = state_func(NULL);                                                       \
+        k_spinlock_key_t key = k_spin_lock(&listener##_lock);                                      \
+        __##listener##_state = state;                                                              \
+        const uint32_t changed = publish(state);                                                   \
+        k_spin_unlock(&listener##_lock, key);                                                      \
+        notify(changed);                                                                           \
+    }                                                                                              \
+                                                                                                   \
+    static int listener##_cb(const zmk_event_t *eh) {                                              \
+        if (!zmk_display_is_initialized()) {                                                       \
+            return ZMK_EV_EVENT_BUBBLE;                                                            \
+        }                                                                                          \
+                                                                                                   \
+        state_type state = state_func(eh);                                                         \
+        uint32_t changed = 0;                                                                      \
+        k_spinlock_key_t key = k_spin_lock(&listener##_lock);                                      \
+        const bool visible = filter_func(&__##listener##_state, &state);                           \
+                                                                                                   \
+        listener_received(event, !visible);                                                        \
+        if (visible) {                                                                             \
+            latency_event(event);                                                                  \
+            __##listener##_state = state;                                                          \
+            changed = publish(state);                                                              \
+        }                                                                                          \
+        k_spin_unlock(&listener##_lock, key);                                                      \
+                                                                                                   \
+        if (visible) {                                                                             \
+            notify(changed);                                                                       \
+        }                                                                                          \
+        return ZMK_EV_EVENT_BUBBLE;                                                                \
+    }                                                                                              \
+                                                                                                   \
+    ZMK_LISTENER(listener, listener##_cb);
+
+struct battery_status_state {
+    uint8_t level;
+#if IS_ENABLED(CONFIG_USB_DEVICE_STACK)
+    bool usb_present;
+#endif
+};
+
+// Battery events only matter when they move the bar or the charging bolt
+static inline bool battery_status_visible(const struct battery_status_state *prev,
+                                          struct battery_status_state *next) {
+#if IS_ENABLED(CONFIG_USB_DEVICE_STACK)
+    if (prev->usb_present != next->usb_present) {
+        return true;
+    }
+#endif
+    return battery_bar_width(prev->level) != battery_bar_width(next->level);
+}
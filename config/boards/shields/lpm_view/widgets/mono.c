@@ -0,0 +1,262 @@
+/*
+ *
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <string.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+
+#include "mono.h"
+
+// Spans are split into a partial first byte, whole bytes in the middle and a
+// partial last byte. The middle is processed 32 bits at a time: as big-endian
+// words for blits, so pixel order matches memory order, and as plain words for
+// fills and inversions, where byte order does not matter. On Cortex-M the word
+// loads and stores may be unaligned and the byte swaps are single REV
+// instructions, so this portable code is also the fast path there.
+
+static inline uint32_t load_be32(const uint8_t *p) {
+    uint32_t word;
+    memcpy(&word, p, sizeof(word));
+    return sys_be32_to_cpu(word);
+}
+
+static inline void store_be32(uint8_t *p, uint32_t word) {
+    word = sys_cpu_to_be32(word);
+    memcpy(p, &word, sizeof(word));
+}
+
+static inline uint32_t apply(uint32_t dst, uint32_t src, uint32_t mask, enum mono_op op) {
+    switch (op) {
+    case MONO_OP_COPY:
+        return (dst & ~mask) | (src & mask);
+    case MONO_OP_OR:
+        return dst | (src & mask);
+    case MONO_OP_CLEAR:
+        return dst & ~(src & mask);
+    case MONO_OP_XOR:
+        return dst ^ (src & mask);
+    }
+    return dst;
+}
+
+// Mask of `n` pixels starting `bit` pixels into a byte
+static inline uint8_t byte_mask(int32_t bit, int32_t n) {
+    return (uint8_t)(0xff << (8 - n)) >> bit;
+}
+
+void mono_fill_span(uint8_t *row, int32_t x, int32_t w, bool set) {
+    uint8_t *p = row + x / 8;
+    const int32_t bit = x % 8;
+
+    if (w <= 0) {
+        return;
+    }
+
+    if (bit != 0) {
+        const int32_t n = MIN(8 - bit, w);
+        const uint8_t mask = byte_mask(bit, n);
+        *p = set ? (*p | mask) : (*p & ~mask);
+        p++;
+        w -= n;
+    }
+
+    // The C library sets whole bytes a word at a time
+    memset(p, set ? 0xff : 0x00, w / 8);
+    p += w / 8;
+
+    if (w % 8 != 0) {
+        const uint8_t mask = byte_mask(0, w % 8);
+        *p = set ? (*p | mask) : (*p & ~mask);
+    }
+}
+
+void mono_invert_span(uint8_t *row, int32_t x, int32_t w) {
+    uint8_t *p = row + x / 8;
+    const int32_t bit = x % 8;
+
+    if (w <= 0) {
+        return;
+    }
+
+    if (bit != 0) {
+        const int32_t n = MIN(8 - bit, w);
+        *p++ ^= byte_mask(bit, n);
+        w -= n;
+    }
+
+    for (; w >= 32; w -= 32, p += 4) {
+        uint32_t word;
+        memcpy(&word, p, sizeof(word));
+        word = ~word;
+        memcpy(p, &word, sizeof(word));
+    }
+    for (; w >= 8; w -= 8) {
+        *p++ ^= 0xff;
+    }
+
+    if (w > 0) {
+        *p ^= byte_mask(0, w);
+    }
+}
+
+void mono_fill_rect(uint8_t *buf, uint32_t stride, int32_t x, int32_t y, int32_t w, int32_t h,
+                    bool set) {
+    for (int32_t r = 0; r < h; r++) {
+        mono_fill_span(buf + (y + r) * stride, x, w, set);
+    }
+}
+
+// Reads `n` (at most 32) source pixels starting at pixel `pos`, into the top of
+// the result. Touches only the bytes that hold them.
+static inline uint32_t load_bits(const uint8_t *src, int32_t pos, int32_t n) {
+    const uint8_t *s = src + pos / 8;
+    const int32_t shift = pos % 8;
+    const int32_t bytes = DIV_ROUND_UP(shift + n, 8);
+    uint64_t acc = 0;
+
+    for (int32_t i = 0; i < bytes; i++) {
+        acc |= (uint64_t)s[i] << (56 - 8 * i);
+    }
+    return (uint32_t)((acc << shift) >> 32);
+}
+
+// Like load_bits() for 32 pixels, when at least 40 source pixels remain and so
+// all five bytes that can hold them exist
+static inline uint32_t load_bits_32(const uint8_t *src, int32_t pos) {
+    const uint8_t *s = src + pos / 8;
+    const int32_t shift = pos % 8;
+    const uint32_t word = load_be32(s);
+
+    return shift == 0 ? word : (word << shift) | (s[4] >> (8 - shift));
+}
+
+void mono_blit_row(uint8_t *dst, int32_t dx, const uint8_t *src, int32_t sx, int32_t w,
+                   enum mono_op op) {
+    uint8_t *d = dst + dx / 8;
+    const int32_t bit = dx % 8;
+
+    if (w <= 0) {
+        return;
+    }
+
+    // Bring the destination to a byte boundary, so the source can be shifted
+    // into place whatever its own alignment
+    if (bit != 0) {
+        const int32_t n = MIN(8 - bit, w);
+        const uint8_t bits = (load_bits(src, sx, n) >> 24) >> bit;
+        *d = apply(*d, bits, byte_mask(bit, n), op);
+        d++;
+        sx += n;
+        w -= n;
+    }
+
+    for (; w >= 32; w -= 32, sx += 32, d += 4) {
+        const uint32_t bits = w >= 40 ? load_bits_32(src, sx) : load_bits(src, sx, 32);
+        store_be32(d, apply(load_be32(d), bits, UINT32_MAX, op));
+    }
+
+    for (; w > 0; w -= 8, sx += 8, d++) {
+        const int32_t n = MIN(8, w);
+        *d = apply(*d, load_bits(src, sx, n) >> 24, byte_mask(0, n), op);
+    }
+}
+
+void mono_blit(uint8_t *dst, uint32_t dst_stride, int32_t dx, int32_t dy, const uint8_t *src,
+               uint32_t src_stride, int32_t sx, int32_t sy, int32_t w, int32_t h, enum mono_op op) {
+    uint8_t *d = dst + dy * dst_stride;
+    const uint8_t *s = src + sy * src_stride;
+
+    // Rows moving down within one buffer are copied bottom up, so none is
+    // overwritten before it is read
+    if (d > s && d < s + h * src_stride) {
+        for (int32_t r = h - 1; r >= 0; r--) {
+            mono_blit_row(d + r * dst_stride, dx, s + r * src_stride, sx, w, op);
+        }
+        return;
+    }
+
+    for (int32_t r = 0; r < h; r++) {
+        mono_blit_row(d + r * dst_stride, dx, s + r * src_stride, sx, w, op);
+    }
+}
+
+// Packs 4 L8 pixels into a nibble, leftmost pixel in the top bit
+static inline uint8_t pack_4(const uint8_t *px, uint32_t xor) {
+    const uint32_t word = load_be32(px) ^ xor;
+
+    return ((word & 0x80808080) * 0x00204081) >> 28;
+}
+
+static inline uint8_t pack_8(const uint8_t *px, int32_t count, uint32_t xor) {
+    if (count == 8) {
+        return pack_4(px, xor) << 4 | pack_4(px + 4, xor);
+    }
+
+    uint8_t bits = 0;
+    for (int32_t i = 0; i < count; i++) {
+        bits |= ((px[i] ^ xor) & 0x80) >> i;
+    }
+    return bits;
+}
+
+// Transposes an 8x8 bit block in place: bit (7 - c) of row r becomes bit (7 - r)
+// of row c (Hacker's Delight, transpose8rS32).
+static inline void transpose_8x8(uint8_t block[8]) {
+    uint32_t x = load_be32(block);
+    uint32_t y = load_be32(block + 4);
+    uint32_t t;
+
+    t = (x ^ (x >> 7)) & 0x00AA00AA;
+    x = x ^ t ^ (t << 7);
+    t = (y ^ (y >> 7)) & 0x00AA00AA;
+    y = y ^ t ^ (t << 7);
+    t = (x ^ (x >> 14)) & 0x0000CCCC;
+    x = x ^ t ^ (t << 14);
+    t = (y ^ (y >> 14)) & 0x0000CCCC;
+    y = y ^ t ^ (t << 14);
+    t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+    y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+    x = t;
+
+    store_be32(block, x);
+    store_be32(block + 4, y);
+}
+
+void mono_rotate_l8(uint8_t *dst, uint32_t dst_stride, int32_t row0, int32_t byte0,
+                    const uint8_t *src, uint32_t src_stride, int32_t size,
+                    const struct mono_area *area, uint8_t background) {
+    // Inverts background pixels to a clear top bit
+    const uint32_t xor = (background & 0x80) ? UINT32_MAX : 0;
+
+    // Source rows are packed and transposed 8x8 at a time, so each block of
+    // eight source rows becomes one destination byte in eight destination rows
+    for (int32_t y0 = area->y1 & ~7; y0 <= area->y2; y0 += 8) {
+        const int32_t rows = MIN(8, size - y0);
+        uint8_t mask = 0xff;
+        if (y0 < area->y1) {
+            mask &= 0xff >> (area->y1 - y0);
+        }
+        if (y0 + 7 > area->y2) {
+            mask &= 0xff << (y0 + 7 - area->y2);
+        }
+
+        for (int32_t x0 = area->x1; x0 <= area->x2; x0 += 8) {
+            const int32_t cols = MIN(8, area->x2 - x0 + 1);
+            uint8_t block[8] = {0};
+
+            for (int32_t r = 0; r < rows; r++) {
+                block[r] = pack_8(src + (y0 + r) * src_stride + x0, cols, xor);
+            }
+            transpose_8x8(block);
+
+            for (int32_t c = 0; c < cols; c++) {
+                uint8_t *d = dst + (size - 1 - x0 - c - row0) * dst_stride + y0 / 8 - byte0;
+                *d = (*d & ~mask) | (block[c] & mask);
+            }
+        }
+    }
+}
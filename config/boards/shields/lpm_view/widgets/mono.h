@@ -0,0 +1,52 @@
+/*
+ *
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Kernels for packed 1 bpp buffers with the leftmost pixel in the top bit of
+// each byte, as used by the I1 canvases, the line flush shadow and the lean
+// framebuffer. Positions and widths are in pixels; callers clip.
+
+// Inclusive pixel bounds, laid out like lv_area_t
+struct mono_area {
+    int32_t x1;
+    int32_t y1;
+    int32_t x2;
+    int32_t y2;
+};
+
+enum mono_op {
+    // dst = src
+    MONO_OP_COPY,
+    // Sets the pixels set in src
+    MONO_OP_OR,
+    // Clears the pixels set in src
+    MONO_OP_CLEAR,
+    // Inverts the pixels set in src
+    MONO_OP_XOR,
+};
+
+void mono_fill_span(uint8_t *row, int32_t x, int32_t w, bool set);
+void mono_invert_span(uint8_t *row, int32_t x, int32_t w);
+void mono_fill_rect(uint8_t *buf, uint32_t stride, int32_t x, int32_t y, int32_t w, int32_t h,
+                    bool set);
+void mono_blit_row(uint8_t *dst, int32_t dx, const uint8_t *src, int32_t sx, int32_t w,
+                   enum mono_op op);
+void mono_blit(uint8_t *dst, uint32_t dst_stride, int32_t dx, int32_t dy, const uint8_t *src,
+               uint32_t src_stride, int32_t sx, int32_t sy, int32_t w, int32_t h, enum mono_op op);
+// Rotates an area of a square L8 buffer `size` pixels wide by 90 degrees into a
+// packed buffer, (x, y) -> (y, size - 1 - x) as lv_draw_sw_rotate() does for
+// LV_DISPLAY_ROTATION_90. Pixels whose top bit differs from that of
+// `background` become set bits. The first row of `dst` is rotated row `row0`
+// and its first byte is rotated byte `byte0`; other bits of the bytes written
+// are kept.
+void mono_rotate_l8(uint8_t *dst, uint32_t dst_stride, int32_t row0, int32_t byte0,
+                    const uint8_t *src, uint32_t src_stride, int32_t size,
+                    const struct mono_area *area, uint8_t background);
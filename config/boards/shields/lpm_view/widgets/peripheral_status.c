@@ -21,37 +21,66 @@ LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 #include <zmk/usb.h>
 #include <zmk/ble.h>
 
+#include "art.h"
+#include "bench.h"
 #include "peripheral_status.h"
-
-LV_IMG_DECLARE(balloon);
-LV_IMG_DECLARE(mountain);
+#include "latency.h"
+#include "listener.h"
+#include "profile.h"
+#include "frame_arena.h"
 
 static sys_slist_t widgets = SYS_SLIST_STATIC_INIT(&widgets);
 
+// The only text drawn through LVGL is the Montserrat 16 output symbol
+#define ARENA_FONT_SIZE 16
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_FRAME_ARENA)
+BUILD_ASSERT(CONFIG_NICE_VIEW_WIDGET_FRAME_ARENA_SIZE >= FRAME_ARENA_WORST_CASE(ARENA_FONT_SIZE),
+             "NICE_VIEW_WIDGET_FRAME_ARENA_SIZE is too small for the Montserrat 16 glyphs");
+#endif
+
 struct peripheral_status_state {
     bool connected;
 };
 
-static void draw_top(lv_obj_t *widget, lv_color_t cbuf[], const struct status_state *state) {
-    lv_obj_t *canvas = lv_obj_get_child(widget, 0);
+static const lv_area_t full_area = CANVAS_FULL_AREA;
+
+static const lv_area_t battery_area = {0, 0, 33, 17};
+
+// The battery goes straight into the packed canvas; only connection changes
+// need LVGL, and with it the LVGL heap, to draw the output symbol
+static void draw_top(lv_obj_t *widget, const struct status_state *state, bool output) {
+    lv_obj_t *top = lv_obj_get_child(widget, 0);
+
+    if (!output) {
+        canvas_fill_area(top, battery_area.x1, battery_area.y1, lv_area_get_width(&battery_area),
+                         lv_area_get_height(&battery_area), false);
+        draw_battery(top, state);
+        canvas_invalidate_area(top, &battery_area);
+        return;
+    }
+
+    lv_obj_t *canvas = canvas_scratch();
 
     lv_draw_label_dsc_t label_dsc;
-    init_label_dsc(&label_dsc, LVGL_FOREGROUND, &lv_font_montserrat_16, LV_TEXT_ALIGN_RIGHT);
-    lv_draw_rect_dsc_t rect_black_dsc;
-    init_rect_dsc(&rect_black_dsc, LVGL_BACKGROUND);
+    init_label_dsc(&label_dsc, LVGL_FOREGROUND, FONT_MONTSERRAT_16, LV_TEXT_ALIGN_RIGHT);
 
     // Fill background
-    canvas_draw_rect(canvas, 0, 0, CANVAS_SIZE, CANVAS_SIZE, &rect_black_dsc);
+    canvas_scratch_clear(&full_area);
 
-    // Draw battery
-    draw_battery(canvas, state);
+    canvas_begin(canvas);
 
     // Draw output status
     canvas_draw_text(canvas, 0, 0, CANVAS_SIZE, &label_dsc,
                      state->connected ? LV_SYMBOL_WIFI : LV_SYMBOL_CLOSE);
 
-    // Rotate canvas
-    rotate_canvas(canvas);
+    canvas_finish(canvas);
+
+    // Rotate canvas into place
+    canvas_rotate_area(top, &full_area);
+
+    // Draw battery straight into the packed canvas
+    draw_battery(top, state);
+    frame_arena_end_frame();
 }
 
 static void set_battery_status(struct zmk_widget_status *widget,
@@ -62,7 +91,10 @@ static void set_battery_status(struct zmk_widget_status *widget,
 
     widget->state.battery = state.level;
 
-    draw_top(widget->obj, widget->cbuf, &widget->state);
+    profile_time_t start = profile_start();
+    draw_top(widget->obj, &widget->state, false);
+    profile_stop(PROFILE_PERIPHERAL_TOP, start);
+    latency_rendered(BIT(LATENCY_BATTERY));
 }
 
 static void battery_status_update_cb(struct battery_status_state state) {
@@ -79,15 +111,16 @@ static struct battery_status_state battery_status_get_state(const zmk_event_t *e
     };
 }
 
-ZMK_DISPLAY_WIDGET_LISTENER(widget_battery_status, struct battery_status_state,
-                            battery_status_update_cb, battery_status_get_state)
+NICE_VIEW_WIDGET_LISTENER(widget_battery_status, struct battery_status_state,
+                          battery_status_update_cb, battery_status_get_state,
+                          battery_status_visible, LATENCY_BATTERY)
 
 ZMK_SUBSCRIPTION(widget_battery_status, zmk_battery_state_changed);
 #if IS_ENABLED(CONFIG_USB_DEVICE_STACK)
 ZMK_SUBSCRIPTION(widget_battery_status, zmk_usb_conn_state_changed);
 #endif /* IS_ENABLED(CONFIG_USB_DEVICE_STACK) */
 
-static struct peripheral_status_state get_state(const zmk_event_t *_eh) {
+static struct peripheral_status_state get_state(const zmk_event_t *eh) {
     return (struct peripheral_status_state){.connected = zmk_split_bt_peripheral_is_connected()};
 }
 
@@ -95,7 +128,10 @@ static void set_connection_status(struct zmk_widget_status *widget,
                                   struct peripheral_status_state state) {
     widget->state.connected = state.connected;
 
-    draw_top(widget->obj, widget->cbuf, &widget->state);
+    profile_time_t start = profile_start();
+    draw_top(widget->obj, &widget->state, true);
+    profile_stop(PROFILE_PERIPHERAL_TOP, start);
+    latency_rendered(BIT(LATENCY_CONNECTION));
 }
 
 static void output_status_update_cb(struct peripheral_status_state state) {
@@ -103,25 +139,57 @@ static void output_status_update_cb(struct peripheral_status_state state) {
     SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) { set_connection_status(widget, state); }
 }
 
-ZMK_DISPLAY_WIDGET_LISTENER(widget_peripheral_status, struct peripheral_status_state,
-                            output_status_update_cb, get_state)
+static bool connection_visible(const struct peripheral_status_state *prev,
+                               struct peripheral_status_state *next) {
+    return prev->connected != next->connected;
+}
+
+NICE_VIEW_WIDGET_LISTENER(widget_peripheral_status, struct peripheral_status_state,
+                          output_status_update_cb, get_state, connection_visible,
+                          LATENCY_CONNECTION)
 ZMK_SUBSCRIPTION(widget_peripheral_status, zmk_split_peripheral_status_changed);
 
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_BENCH)
+// Feeds scripted events to the same callbacks the ZMK listeners use. Changes are
+// drawn as they arrive, so each event is one frame and there is nothing left
+// to render afterwards.
+void zmk_widget_status_bench_apply(const struct bench_event *event) {
+    profile_time_t frame = profile_start();
+
+    switch (event->type) {
+    case BENCH_EVENT_BATTERY:
+        battery_status_update_cb((struct battery_status_state){.level = event->value});
+        break;
+    case BENCH_EVENT_CONNECTION:
+        output_status_update_cb((struct peripheral_status_state){.connected = event->value});
+        break;
+    }
+
+    profile_stop(PROFILE_FRAME, frame);
+}
+
+void zmk_widget_status_bench_render(void) {}
+#endif /* IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_BENCH) */
+
 int zmk_widget_status_init(struct zmk_widget_status *widget, lv_obj_t *parent) {
     widget->obj = lv_obj_create(parent);
     lv_obj_set_size(widget->obj, 144, 72);
     lv_obj_t *top = lv_canvas_create(widget->obj);
     lv_obj_align(top, LV_ALIGN_TOP_RIGHT, 0, 0);
-    lv_canvas_set_buffer(top, widget->cbuf, CANVAS_SIZE, CANVAS_SIZE, CANVAS_COLOR_FORMAT);
+    canvas_set_buffer(top, widget->cbuf);
 
+    art_decoder_init();
     lv_obj_t *art = lv_img_create(widget->obj);
-    bool random = sys_rand32_get() & 1;
-    lv_image_set_src(art, random ? &balloon : &mountain);
+    lv_image_set_src(art, art_images[sys_rand32_get() % art_image_count]);
     lv_obj_align(art, LV_ALIGN_TOP_LEFT, 0, 0);
 
+    canvas_scratch_init(widget->obj);
+    frame_arena_init(ARENA_FONT_SIZE);
+
     sys_slist_append(&widgets, &widget->node);
     widget_battery_status_init();
     widget_peripheral_status_init();
+    bench_run();
 
     return 0;
 }
@@ -14,7 +14,7 @@
 struct zmk_widget_status {
     sys_snode_t node;
     lv_obj_t *obj;
-    lv_color_t cbuf[CANVAS_SIZE * CANVAS_SIZE];
+    uint8_t cbuf[CANVAS_BUF_SIZE];
     struct status_state state;
 };
 
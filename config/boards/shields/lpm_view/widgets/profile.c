@@ -0,0 +1,132 @@
+/*
+ *
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/shell/shell.h>
+#include <lvgl.h>
+
+#if LV_USE_STDLIB_MALLOC != LV_STDLIB_BUILTIN
+#include <lvgl_mem.h>
+#endif
+
+#include "profile.h"
+#include "frame_arena.h"
+
+// canvas_draw_* only queue draw tasks; the rasterisation they cause is counted
+// under layer_dispatch, which also covers the LVGL draw units.
+static const char *const slot_names[PROFILE_SLOT_COUNT] = {
+    [PROFILE_FRAME] = "frame",
+    [PROFILE_DRAW_TOP] = "draw_top",
+    [PROFILE_DRAW_MIDDLE] = "draw_middle",
+    [PROFILE_DRAW_BOTTOM] = "draw_bottom",
+    [PROFILE_PERIPHERAL_TOP] = "peripheral_draw_top",
+    [PROFILE_ROTATE] = "rotate",
+    [PROFILE_FLUSH] = "flush",
+    [PROFILE_LAYER_DISPATCH] = "layer_dispatch",
+    [PROFILE_DRAW_LINE] = "canvas_draw_line",
+    [PROFILE_DRAW_RECT] = "canvas_draw_rect",
+    [PROFILE_DRAW_ARC] = "canvas_draw_arc",
+    [PROFILE_DRAW_TEXT] = "canvas_draw_text",
+    [PROFILE_DRAW_IMG] = "canvas_draw_img",
+    [PROFILE_BLIT_NUMBER] = "canvas_blit_number",
+    [PROFILE_ART_DECODE] = "art_decode",
+};
+
+static struct k_spinlock lock;
+static struct profile_counter counters[PROFILE_SLOT_COUNT];
+
+void profile_init(void) {
+#if IS_ENABLED(CONFIG_TIMING_FUNCTIONS)
+    timing_init();
+    timing_start();
+#endif
+}
+
+void profile_stop(enum profile_slot slot, profile_time_t start) {
+#if IS_ENABLED(CONFIG_TIMING_FUNCTIONS)
+    timing_t end = timing_counter_get();
+    uint32_t cycles = timing_cycles_get(&start, &end);
+#else
+    uint32_t cycles = k_cycle_get_32() - start;
+#endif
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    struct profile_counter *counter = &counters[slot];
+
+    counter->calls++;
+    counter->cycles += cycles;
+    counter->max_cycles = MAX(counter->max_cycles, cycles);
+
+    k_spin_unlock(&lock, key);
+}
+
+void profile_get(enum profile_slot slot, struct profile_counter *out) {
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    *out = counters[slot];
+    k_spin_unlock(&lock, key);
+}
+
+void profile_reset(void) {
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    memset(counters, 0, sizeof(counters));
+    k_spin_unlock(&lock, key);
+}
+
+uint64_t profile_cycles_to_us(uint64_t cycles) {
+#if IS_ENABLED(CONFIG_TIMING_FUNCTIONS)
+    return timing_cycles_to_ns(cycles) / 1000;
+#else
+    return k_cyc_to_us_floor64(cycles);
+#endif
+}
+
+const char *profile_slot_name(enum profile_slot slot) { return slot_names[slot]; }
+
+#if IS_ENABLED(CONFIG_SHELL)
+static int cmd_stats(const struct shell *sh, size_t argc, char **argv) {
+    struct profile_counter c;
+
+    if (argc > 1 && strcmp(argv[1], "reset") == 0) {
+        profile_reset();
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_FRAME_ARENA)
+        frame_arena_reset_stats();
+#endif
+        return 0;
+    }
+
+    for (int i = 0; i < PROFILE_SLOT_COUNT; i++) {
+        profile_get(i, &c);
+        shell_print(sh, "%-20s calls=%u total=%uus max=%uus", slot_names[i], c.calls,
+                    (uint32_t)profile_cycles_to_us(c.cycles),
+                    (uint32_t)profile_cycles_to_us(c.max_cycles));
+    }
+
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    shell_print(sh, "lvgl heap: used=%u max=%u total=%u", mon.total_size - mon.free_size,
+                mon.max_used, mon.total_size);
+#else
+    // Zephyr's LVGL heap reports its own usage, including the high-water mark
+    lvgl_print_heap_info(false);
+#endif
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_FRAME_ARENA)
+    struct frame_arena_stats arena;
+    frame_arena_get_stats(&arena);
+    shell_print(sh, "frame arena: used=%u max=%u size=%u worst=%u overflows=%u held=%u",
+                arena.used, arena.high_water, arena.size, arena.worst_case, arena.overflows,
+                arena.held_frames);
+    shell_print(sh, "lvgl heap draw tasks: %u", arena.heap_tasks);
+#endif
+
+    return 0;
+}
+
+SHELL_CMD_ARG_REGISTER(lpm_stats, NULL, "Print status display render counters [reset]", cmd_stats,
+                       1, 1);
+#endif /* IS_ENABLED(CONFIG_SHELL) */
@@ -0,0 +1,67 @@
+/*
+ *
+ * Copyright (c) 2025 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <zephyr/kernel.h>
+
+#if IS_ENABLED(CONFIG_TIMING_FUNCTIONS)
+#include <zephyr/timing/timing.h>
+#endif
+
+enum profile_slot {
+    PROFILE_FRAME,
+    PROFILE_DRAW_TOP,
+    PROFILE_DRAW_MIDDLE,
+    PROFILE_DRAW_BOTTOM,
+    PROFILE_PERIPHERAL_TOP,
+    PROFILE_ROTATE,
+    PROFILE_FLUSH,
+    PROFILE_LAYER_DISPATCH,
+    PROFILE_DRAW_LINE,
+    PROFILE_DRAW_RECT,
+    PROFILE_DRAW_ARC,
+    PROFILE_DRAW_TEXT,
+    PROFILE_DRAW_IMG,
+    PROFILE_BLIT_NUMBER,
+    PROFILE_ART_DECODE,
+    PROFILE_SLOT_COUNT,
+};
+
+struct profile_counter {
+    uint32_t calls;
+    uint32_t max_cycles;
+    uint64_t cycles;
+};
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_PROFILE)
+
+// The DWT cycle counter where the timing API has one, the kernel cycle counter
+// otherwise
+#if IS_ENABLED(CONFIG_TIMING_FUNCTIONS)
+typedef timing_t profile_time_t;
+static inline profile_time_t profile_start(void) { return timing_counter_get(); }
+#else
+typedef uint32_t profile_time_t;
+static inline profile_time_t profile_start(void) { return k_cycle_get_32(); }
+#endif
+
+void profile_init(void);
+void profile_stop(enum profile_slot slot, profile_time_t start);
+void profile_get(enum profile_slot slot, struct profile_counter *out);
+void profile_reset(void);
+uint64_t profile_cycles_to_us(uint64_t cycles);
+const char *profile_slot_name(enum profile_slot slot);
+
+#else
+
+typedef uint32_t profile_time_t;
+static inline void profile_init(void) {}
+static inline profile_time_t profile_start(void) { return 0; }
+static inline void profile_stop(enum profile_slot slot, profile_time_t start) {}
+
+#endif /* IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_PROFILE) */
@@ -5,7 +5,11 @@
  *
  */
 
+#include <stdlib.h>
 #include <zephyr/kernel.h>
+#include <zephyr/settings/settings.h>
+#include <zephyr/sys/barrier.h>
+#include <zephyr/sys/crc.h>
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
@@ -13,6 +17,17 @@ LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 #include <zmk/battery.h>
 #include <zmk/display.h>
 #include "status.h"
+#include "bench.h"
+#include "profile.h"
+#include "latency.h"
+#include "listener.h"
+#include "frame_arena.h"
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_RENDERER_LEAN)
+#include "lean.h"
+#include "../display_flush.h"
+#endif
+#include <zmk/activity.h>
+#include <zmk/events/activity_state_changed.h>
 #include <zmk/events/usb_conn_state_changed.h>
 #include <zmk/event_manager.h>
 #include <zmk/events/battery_state_changed.h>
@@ -26,7 +41,96 @@ LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 #include <zmk/keymap.h>
 #include <zmk/wpm.h>
 
-static sys_slist_t widgets = SYS_SLIST_STATIC_INIT(&widgets);
+// State and canvases shared by all widget instances. Frames are drawn through
+// the canvases of the first instance; the others point at the same buffers and
+// are invalidated as mirrors of them. Only the display work queue touches it.
+static struct {
+    lv_obj_t *obj;
+    struct status_frame frame;
+    // The state the frame shows
+    struct status_state rendered;
+    // Snapshot of the live state that the current frame is drawn from, and
+    // the sequence number it was taken at
+    struct status_state state;
+    atomic_val_t seq;
+    uint32_t dirty;
+} store;
+
+// The latest state, written by the listeners from the context of their events
+// and read by the renderer once per frame. It is a sequence lock: writers are
+// serialised by the spinlock and bump `seq` before and after each change, so
+// it is odd while one is in progress. Readers copy the state and retry if
+// `seq` was odd or has moved, so they never block writers or see half of a
+// change.
+static struct {
+    struct k_spinlock lock;
+    atomic_t seq;
+    struct status_state state;
+} live;
+
+static struct status_state *state_write_begin(k_spinlock_key_t *key) {
+    *key = k_spin_lock(&live.lock);
+    atomic_inc(&live.seq);
+    return &live.state;
+}
+
+static void state_write_end(k_spinlock_key_t key) {
+    atomic_inc(&live.seq);
+    k_spin_unlock(&live.lock, key);
+}
+
+// Returns the sequence number of the copy, which moves on with every change
+static atomic_val_t state_read(struct status_state *out) {
+    atomic_val_t seq;
+
+    do {
+        seq = atomic_get(&live.seq);
+        memcpy(out, &live.state, sizeof(*out));
+        barrier_dmem_fence_full();
+    } while ((seq & 1) || atomic_get(&live.seq) != seq);
+
+    return seq;
+}
+
+#define FRAME_INTERVAL_MS (1000 / CONFIG_NICE_VIEW_WIDGET_MAX_FPS)
+
+// The largest font drawn through LVGL is the Montserrat 18 of the profile numbers
+#define ARENA_FONT_SIZE 18
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_FRAME_ARENA)
+BUILD_ASSERT(CONFIG_NICE_VIEW_WIDGET_FRAME_ARENA_SIZE >= FRAME_ARENA_WORST_CASE(ARENA_FONT_SIZE),
+             "NICE_VIEW_WIDGET_FRAME_ARENA_SIZE is too small for the Montserrat 18 glyphs");
+#endif
+
+// Changes that skip the frame rate limit and are rendered on their own
+#define STATUS_URGENT                                                                              \
+    ((IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_URGENT_LAYER) ? STATUS_DIRTY_LAYER : 0) |                \
+     (IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_URGENT_OUTPUT)                                            \
+          ? STATUS_DIRTY_OUTPUT | STATUS_DIRTY_PROFILES                                           \
+          : 0))
+
+static void render_frame(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(render_work, render_frame);
+static void render_urgent_frame(struct k_work *work);
+static K_WORK_DEFINE(urgent_work, render_urgent_frame);
+static void schedule_frame(uint32_t changed);
+// Uptime in ms of the last regular frame, read by the setters on any thread
+static atomic_t last_frame_time = ATOMIC_INIT(-FRAME_INTERVAL_MS);
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_PAUSE_WHEN_IDLE)
+// Set while the keyboard is idle or asleep. Setters keep recording state, but
+// only the changes in STATUS_PAUSED are rendered until activity resumes.
+static atomic_t paused;
+
+#if IS_ENABLED(CONFIG_ZMK_DISPLAY_BLANK_ON_IDLE)
+// The screen is blanked, so nothing is drawn; changes stay unrendered and the
+// frame on resume picks them up
+#define STATUS_PAUSED 0
+#else
+// The screen stays on, and the battery level and charging state can change
+// for a long time while the keyboard sits idle
+#define STATUS_PAUSED STATUS_DIRTY_BATTERY
+#endif
+#endif
 
 struct output_status_state {
     struct zmk_endpoint_instance selected_endpoint;
@@ -44,29 +148,117 @@ struct layer_status_state {
 
 struct wpm_status_state {
     uint8_t wpm;
+    // Bookkeeping of the listener filter: the direction of the last change
+    // passed on, and how many samples in a row have had this value
+    int8_t trend;
+    uint8_t repeats;
 };
 
-static void draw_top(lv_obj_t *widget, const struct status_state *state) {
-    lv_obj_t *canvas = lv_obj_get_child(widget, 0);
+#if !IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_RENDERER_LEAN)
+// Logical (pre-rotation) regions that are repainted independently
+static const lv_area_t top_battery_area = {0, 0, 33, 17};
+static const lv_area_t top_output_area = {34, 0, CANVAS_SIZE - 1, 19};
+static const lv_area_t top_wpm_area = {0, 21, CANVAS_SIZE - 1, 52};
+static const lv_area_t wpm_graph_area = {1, 22, 66, 51};
+static const lv_area_t wpm_text_area = {42, 42, 66, 49};
 
-    lv_draw_label_dsc_t label_dsc;
-    init_label_dsc(&label_dsc, LVGL_FOREGROUND, &lv_font_montserrat_16, LV_TEXT_ALIGN_RIGHT);
-    lv_draw_label_dsc_t label_dsc_wpm;
-    init_label_dsc(&label_dsc_wpm, LVGL_FOREGROUND, &lv_font_unscii_8, LV_TEXT_ALIGN_RIGHT);
-    lv_draw_rect_dsc_t rect_black_dsc;
-    init_rect_dsc(&rect_black_dsc, LVGL_BACKGROUND);
-    lv_draw_rect_dsc_t rect_white_dsc;
-    init_rect_dsc(&rect_white_dsc, LVGL_FOREGROUND);
-    lv_draw_line_dsc_t line_dsc;
-    init_line_dsc(&line_dsc, LVGL_FOREGROUND, 1);
+static const lv_area_t full_area = CANVAS_FULL_AREA;
 
-    // Fill background
-    lv_canvas_fill_bg(canvas, LVGL_BACKGROUND, LV_OPA_COVER);
+static const int circle_offsets[NICEVIEW_PROFILE_COUNT][2] = {
+    {13, 13}, {55, 13}, {34, 34}, {13, 55}, {55, 55},
+};
 
-    // Draw battery
-    draw_battery(canvas, state);
+// Bounding box of a profile circle, clipped to the canvas
+static lv_area_t profile_area(int i) {
+    return (lv_area_t){circle_offsets[i][0] - 13, circle_offsets[i][1] - 13,
+                       MIN(circle_offsets[i][0] + 13, CANVAS_SIZE - 1),
+                       MIN(circle_offsets[i][1] + 13, CANVAS_SIZE - 1)};
+}
+#endif /* !IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_RENDERER_LEAN) */
+
+static bool labels_equal(const char *a, const char *b) {
+    if (a == b) {
+        return true;
+    }
+    if (a == NULL || b == NULL) {
+        return false;
+    }
+    return strcmp(a, b) == 0;
+}
+
+static uint32_t status_state_diff(const struct status_state *a, const struct status_state *b) {
+    uint32_t dirty = 0;
+
+    if (a->battery != b->battery || a->charging != b->charging) {
+        dirty |= STATUS_DIRTY_BATTERY;
+    }
+
+    if (a->selected_endpoint.transport != b->selected_endpoint.transport ||
+        a->active_profile_connected != b->active_profile_connected ||
+        a->active_profile_bonded != b->active_profile_bonded) {
+        dirty |= STATUS_DIRTY_OUTPUT;
+    }
+
+    if (a->wpm_samples != b->wpm_samples) {
+        dirty |= STATUS_DIRTY_WPM;
+    }
+
+    for (int i = 0; i < NICEVIEW_PROFILE_COUNT; i++) {
+        if (a->profiles_connected[i] != b->profiles_connected[i] ||
+            a->profiles_bonded[i] != b->profiles_bonded[i] ||
+            (a->active_profile_index == i) != (b->active_profile_index == i)) {
+            dirty |= STATUS_DIRTY_PROFILE(i);
+        }
+    }
+
+    if (a->layer_index != b->layer_index || !labels_equal(a->layer_label, b->layer_label)) {
+        dirty |= STATUS_DIRTY_LAYER;
+    }
+
+    return dirty;
+}
+
+// Marks the parts of `src` covered by `dirty` as rendered
+static void status_state_commit(struct status_state *dst, const struct status_state *src,
+                                uint32_t dirty) {
+    if (dirty == STATUS_DIRTY_ALL) {
+        *dst = *src;
+        return;
+    }
+
+    if (dirty & STATUS_DIRTY_BATTERY) {
+        dst->battery = src->battery;
+        dst->charging = src->charging;
+    }
+
+    if (dirty & (STATUS_DIRTY_OUTPUT | STATUS_DIRTY_PROFILES)) {
+        dst->selected_endpoint = src->selected_endpoint;
+        dst->active_profile_index = src->active_profile_index;
+        dst->active_profile_connected = src->active_profile_connected;
+        dst->active_profile_bonded = src->active_profile_bonded;
+        memcpy(dst->profiles_connected, src->profiles_connected, sizeof(dst->profiles_connected));
+        memcpy(dst->profiles_bonded, src->profiles_bonded, sizeof(dst->profiles_bonded));
+    }
+
+    if (dirty & STATUS_DIRTY_WPM) {
+        memcpy(dst->wpm, src->wpm, sizeof(dst->wpm));
+        dst->wpm_head = src->wpm_head;
+        dst->wpm_min = src->wpm_min;
+        dst->wpm_max = src->wpm_max;
+        dst->wpm_samples = src->wpm_samples;
+    }
+
+    if (dirty & STATUS_DIRTY_LAYER) {
+        dst->layer_index = src->layer_index;
+        dst->layer_label = src->layer_label;
+    }
+}
+
+#if !IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_RENDERER_LEAN)
+static void draw_output_status(lv_obj_t *canvas, const struct status_state *state) {
+    lv_draw_label_dsc_t label_dsc;
+    init_label_dsc(&label_dsc, LVGL_FOREGROUND, FONT_MONTSERRAT_16, LV_TEXT_ALIGN_RIGHT);
 
-    // Draw output status
     char output_text[10] = {};
 
     switch (state->selected_endpoint.transport) {
@@ -87,137 +279,483 @@ static void draw_top(lv_obj_t *widget, const struct status_state *state) {
     }
 
     canvas_draw_text(canvas, 0, 0, CANVAS_SIZE, &label_dsc, output_text);
+}
 
-    // Draw WPM
-    canvas_draw_rect(canvas, 0, 21, 70, 32, &rect_white_dsc);
-    canvas_draw_rect(canvas, 1, 22, 66, 30, &rect_black_dsc);
-
-    char wpm_text[6] = {};
-    snprintf(wpm_text, sizeof(wpm_text), "%d", state->wpm[9]);
-    canvas_draw_text(canvas, 42, 42, 24, &label_dsc_wpm, wpm_text);
+static struct glyph_atlas wpm_digits;
+static struct glyph_atlas layer_digits;
 
-    int max = 0;
-    int min = 256;
+static inline int32_t wpm_x(int i) { return 2 + i * WPM_STEP; }
 
-    for (int i = 0; i < 10; i++) {
-        if (state->wpm[i] > max) {
-            max = state->wpm[i];
+// Draws the graph segments and the WPM number that reach into `area`
+static void draw_wpm_graph(lv_obj_t *canvas, const struct status_state *state,
+                           const lv_area_t *area) {
+    lv_draw_label_dsc_t label_dsc_wpm;
+    init_label_dsc(&label_dsc_wpm, LVGL_FOREGROUND, FONT_UNSCII_8, LV_TEXT_ALIGN_RIGHT);
+
+    // Samples are evenly spaced and x only grows, so the segments that touch the
+    // area are one contiguous run of the polyline.
+    int first = WPM_HISTORY;
+    int last = 0;
+    lv_point_t points[WPM_HISTORY];
+    for (int i = 0; i < WPM_HISTORY; i++) {
+        uint8_t wpm = state->wpm[(state->wpm_head + i) % WPM_HISTORY];
+        points[i].x = wpm_x(i);
+        points[i].y = wpm_graph_y(wpm, state->wpm_min, state->wpm_max);
+
+        if (points[i].x >= area->x1 - WPM_STEP && points[i].x <= area->x2 + WPM_STEP) {
+            first = MIN(first, i);
+            last = i;
         }
-        if (state->wpm[i] < min) {
-            min = state->wpm[i];
+    }
+    // The graph is drawn on every new sample, so it skips LVGL and its heap.
+    // Scratch pixels outside the area are not being repainted and stay as they are.
+    if (first < last) {
+        canvas_scratch_polyline(&points[first], last - first + 1, area);
+    }
+
+    if (area_overlaps(area, &wpm_text_area)) {
+        uint8_t newest = state->wpm[(state->wpm_head + WPM_HISTORY - 1) % WPM_HISTORY];
+        if (!canvas_blit_number(canvas, &wpm_digits, wpm_text_area.x1, wpm_text_area.y1, 24,
+                                LV_TEXT_ALIGN_RIGHT, newest)) {
+            char wpm_text[6] = {};
+            snprintf(wpm_text, sizeof(wpm_text), "%d", newest);
+            canvas_draw_text(canvas, wpm_text_area.x1, wpm_text_area.y1, 24, &label_dsc_wpm,
+                             wpm_text);
         }
     }
+}
+
+// The WPM box is a one pixel frame around the graph, drawn into the packed
+// canvas after the graph has been rotated into place
+static void draw_wpm_frame(lv_obj_t *canvas) {
+    canvas_fill_area(canvas, 0, 21, 70, 1, true);
+    canvas_fill_area(canvas, 0, 52, 70, 1, true);
+    canvas_fill_area(canvas, 0, 21, 1, 32, true);
+    canvas_fill_area(canvas, 67, 21, 3, 32, true);
+}
+
+static void repaint_wpm_area(lv_obj_t *widget, const struct status_state *state,
+                             const lv_area_t *area) {
+    lv_obj_t *canvas = canvas_scratch();
+
+    canvas_scratch_clear(area);
+
+    canvas_begin(canvas);
+    draw_wpm_graph(canvas, state, area);
+    canvas_finish(canvas);
+
+    canvas_rotate_area(lv_obj_get_child(widget, 0), area);
+}
+
+// While the y-scale is unchanged, new samples only move the graph left. Shift
+// the pixels already on the canvas and repaint the new segments on the right and
+// the number, which must not move with the graph. Returns false if the graph
+// has to be redrawn in full.
+static bool scroll_wpm(lv_obj_t *widget, const struct status_state *state,
+                       const struct status_state *prev) {
+    const uint32_t steps = state->wpm_samples - prev->wpm_samples;
+
+    if (steps == 0 || steps >= WPM_HISTORY - 1 || state->wpm_min != prev->wpm_min ||
+        state->wpm_max != prev->wpm_max) {
+        return false;
+    }
 
-    int range = max - min;
-    if (range == 0) {
-        range = 1;
+    const int32_t dx = steps * WPM_STEP;
+    lv_obj_t *canvas = lv_obj_get_child(widget, 0);
+
+    canvas_scroll_area(canvas, &wpm_graph_area, dx);
+    canvas_invalidate_area(canvas, &wpm_graph_area);
+
+    lv_area_t text = wpm_text_area;
+    text.x1 = MAX(wpm_graph_area.x1, text.x1 - dx);
+    repaint_wpm_area(widget, state, &text);
+
+    lv_area_t tail = wpm_graph_area;
+    tail.x1 = wpm_x(WPM_HISTORY - 1 - steps);
+    repaint_wpm_area(widget, state, &tail);
+
+    return true;
+}
+
+static void draw_top(lv_obj_t *widget, const struct status_state *state,
+                     const struct status_state *prev, uint32_t dirty) {
+    lv_area_t area = AREA_EMPTY;
+
+    if (dirty == STATUS_DIRTY_ALL) {
+        area = full_area;
+    }
+    if (dirty & STATUS_DIRTY_BATTERY) {
+        area_join(&area, &top_battery_area);
+    }
+    if (dirty & STATUS_DIRTY_OUTPUT) {
+        area_join(&area, &top_output_area);
+    }
+    if ((dirty & STATUS_DIRTY_WPM) &&
+        (dirty == STATUS_DIRTY_ALL || !scroll_wpm(widget, state, prev))) {
+        area_join(&area, &top_wpm_area);
+    }
+    if (area_is_empty(&area)) {
+        return;
+    }
+
+    lv_obj_t *canvas = canvas_scratch();
+
+    // Clear the area being repainted
+    canvas_scratch_clear(&area);
+
+    canvas_begin(canvas);
+
+    // Draw output status
+    if (area_overlaps(&area, &top_output_area)) {
+        draw_output_status(canvas, state);
     }
 
-    lv_point_t points[10];
-    for (int i = 0; i < 10; i++) {
-        points[i].x = 2 + i * 7;
-        points[i].y = 50 - (state->wpm[i] - min) * 36 / range;
+    // Draw WPM graph
+    if (area_overlaps(&area, &top_wpm_area)) {
+        draw_wpm_graph(canvas, state, &wpm_graph_area);
     }
-    canvas_draw_line(canvas, points, 10, &line_dsc);
 
-    // Rotate canvas
-    rotate_canvas(canvas);
+    canvas_finish(canvas);
+
+    // Rotate the repainted area into place
+    lv_obj_t *top = lv_obj_get_child(widget, 0);
+    canvas_rotate_area(top, &area);
+
+    // Rectangles and the bolt go straight into the packed canvas
+    if (area_overlaps(&area, &top_battery_area)) {
+        draw_battery(top, state);
+    }
+    if (area_overlaps(&area, &top_wpm_area)) {
+        draw_wpm_frame(top);
+    }
 }
 
-static void draw_middle(lv_obj_t *widget, const struct status_state *state) {
-    lv_obj_t *canvas = lv_obj_get_child(widget, 1);
+enum profile_ring {
+    PROFILE_RING_OPEN,
+    PROFILE_RING_BONDED,
+    PROFILE_RING_CONNECTED,
+    PROFILE_RING_COUNT,
+};
 
-    lv_draw_rect_dsc_t rect_black_dsc;
-    init_rect_dsc(&rect_black_dsc, LVGL_BACKGROUND);
-    lv_draw_rect_dsc_t rect_white_dsc;
-    init_rect_dsc(&rect_white_dsc, LVGL_FOREGROUND);
+static void draw_profile(lv_obj_t *canvas, int i, enum profile_ring ring, bool selected) {
     lv_draw_arc_dsc_t arc_dsc;
     init_arc_dsc(&arc_dsc, LVGL_FOREGROUND, 2);
     lv_draw_arc_dsc_t arc_dsc_filled;
     init_arc_dsc(&arc_dsc_filled, LVGL_FOREGROUND, 9);
     lv_draw_label_dsc_t label_dsc;
-    init_label_dsc(&label_dsc, LVGL_FOREGROUND, &lv_font_montserrat_18, LV_TEXT_ALIGN_CENTER);
+    init_label_dsc(&label_dsc, LVGL_FOREGROUND, FONT_MONTSERRAT_18, LV_TEXT_ALIGN_CENTER);
     lv_draw_label_dsc_t label_dsc_black;
-    init_label_dsc(&label_dsc_black, LVGL_BACKGROUND, &lv_font_montserrat_18, LV_TEXT_ALIGN_CENTER);
+    init_label_dsc(&label_dsc_black, LVGL_BACKGROUND, FONT_MONTSERRAT_18, LV_TEXT_ALIGN_CENTER);
+
+    if (ring == PROFILE_RING_CONNECTED) {
+        canvas_draw_arc(canvas, circle_offsets[i][0], circle_offsets[i][1], 13, 0, 360, &arc_dsc);
+    } else if (ring == PROFILE_RING_BONDED) {
+        const int segments = 8;
+        const int gap = 20;
+        for (int j = 0; j < segments; ++j)
+            canvas_draw_arc(canvas, circle_offsets[i][0], circle_offsets[i][1], 13,
+                            360 / segments * j + gap / 2, 360 / segments * (j + 1) - gap / 2,
+                            &arc_dsc);
+    }
 
-    // Fill background
-    lv_canvas_fill_bg(canvas, LVGL_BACKGROUND, LV_OPA_COVER);
+    if (selected) {
+        canvas_draw_arc(canvas, circle_offsets[i][0], circle_offsets[i][1], 9, 0, 359,
+                        &arc_dsc_filled);
+    }
 
-    // Draw circles
-    int circle_offsets[NICEVIEW_PROFILE_COUNT][2] = {
-        {13, 13}, {55, 13}, {34, 34}, {13, 55}, {55, 55},
-    };
+    char label[2];
+    snprintf(label, sizeof(label), "%d", i + 1);
+    canvas_draw_text(canvas, circle_offsets[i][0] - 8, circle_offsets[i][1] - 10, 16,
+                     (selected ? &label_dsc_black : &label_dsc), label);
+}
 
-    for (int i = 0; i < NICEVIEW_PROFILE_COUNT; i++) {
-        bool selected = i == state->active_profile_index;
+// Every profile slot has a fixed position and digit, so only its ring style and
+// selection vary. Each combination is rasterised once, on first use.
+static struct canvas_sprite profile_sprites[NICEVIEW_PROFILE_COUNT][PROFILE_RING_COUNT][2];
+static bool profile_sprites_ready[NICEVIEW_PROFILE_COUNT][PROFILE_RING_COUNT][2];
 
-        if (state->profiles_connected[i]) {
-            canvas_draw_arc(canvas, circle_offsets[i][0], circle_offsets[i][1], 13, 0, 360,
-                            &arc_dsc);
-        } else if (state->profiles_bonded[i]) {
-            const int segments = 8;
-            const int gap = 20;
-            for (int j = 0; j < segments; ++j)
-                canvas_draw_arc(canvas, circle_offsets[i][0], circle_offsets[i][1], 13,
-                                360. / segments * j + gap / 2.0,
-                                360. / segments * (j + 1) - gap / 2.0, &arc_dsc);
+static const struct canvas_sprite *profile_sprite(const struct status_state *state, int i) {
+    enum profile_ring ring = state->profiles_connected[i] ? PROFILE_RING_CONNECTED
+                             : state->profiles_bonded[i]  ? PROFILE_RING_BONDED
+                                                          : PROFILE_RING_OPEN;
+    bool selected = i == state->active_profile_index;
+    struct canvas_sprite *sprite = &profile_sprites[i][ring][selected];
+
+    if (!profile_sprites_ready[i][ring][selected]) {
+        lv_obj_t *canvas = canvas_scratch();
+        lv_area_t area = profile_area(i);
+
+        canvas_scratch_clear(&area);
+
+        canvas_begin(canvas);
+        draw_profile(canvas, i, ring, selected);
+        canvas_finish(canvas);
+
+        canvas_pack_sprite(sprite, &area);
+        profile_sprites_ready[i][ring][selected] = true;
+    }
+
+    return sprite;
+}
+
+static void draw_middle(lv_obj_t *widget, const struct status_state *state, uint32_t dirty) {
+    lv_area_t area = AREA_EMPTY;
+
+    if (dirty == STATUS_DIRTY_ALL) {
+        area = full_area;
+    }
+    for (int i = 0; i < NICEVIEW_PROFILE_COUNT; i++) {
+        if (dirty & STATUS_DIRTY_PROFILE(i)) {
+            lv_area_t ring = profile_area(i);
+            area_join(&area, &ring);
         }
+    }
+    if (area_is_empty(&area)) {
+        return;
+    }
+
+    lv_obj_t *canvas = lv_obj_get_child(widget, 1);
+
+    // Clear the area being repainted
+    canvas_clear_area(canvas, &area);
 
-        if (selected) {
-            canvas_draw_arc(canvas, circle_offsets[i][0], circle_offsets[i][1], 9, 0, 359,
-                            &arc_dsc_filled);
+    // Compose circles, including neighbours whose bounding boxes reach into the
+    // area. Sprites only hold their own ring, so overlapping corners combine.
+    for (int i = 0; i < NICEVIEW_PROFILE_COUNT; i++) {
+        lv_area_t ring = profile_area(i);
+        if (area_overlaps(&area, &ring)) {
+            canvas_blit_sprite(canvas, profile_sprite(state, i));
         }
+    }
+
+    canvas_invalidate_area(canvas, &area);
+}
 
-        char label[2];
-        snprintf(label, sizeof(label), "%d", i + 1);
-        canvas_draw_text(canvas, circle_offsets[i][0] - 8, circle_offsets[i][1] - 10, 16,
-                         (selected ? &label_dsc_black : &label_dsc), label);
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_LAYER_CACHE)
+// Finished bottom canvases of the layers shown so far. Entries keep a copy of
+// the label they were drawn with, so a layer renamed at runtime (ZMK Studio) is
+// drawn again instead of showing its old name.
+#define LAYER_CACHE_LABEL_SIZE 16
+
+struct layer_cache_entry {
+    bool valid;
+    char label[LAYER_CACHE_LABEL_SIZE];
+    uint8_t pixels[CANVAS_PIXELS_SIZE];
+};
+
+static struct layer_cache_entry layer_cache[CONFIG_NICE_VIEW_WIDGET_LAYER_CACHE_SIZE];
+
+// Returns the slot for the state's layer, or NULL if it cannot be cached
+static struct layer_cache_entry *layer_cache_slot(const struct status_state *state) {
+    const char *label = state->layer_label != NULL ? state->layer_label : "";
+
+    if (state->layer_index >= ARRAY_SIZE(layer_cache) ||
+        strlen(label) >= LAYER_CACHE_LABEL_SIZE) {
+        return NULL;
     }
 
-    // Rotate canvas
-    rotate_canvas(canvas);
+    struct layer_cache_entry *entry = &layer_cache[state->layer_index];
+    if (entry->valid && strcmp(entry->label, label) != 0) {
+        entry->valid = false;
+    }
+    if (!entry->valid) {
+        strcpy(entry->label, label);
+    }
+    return entry;
 }
+#endif /* IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_LAYER_CACHE) */
 
-static void draw_bottom(lv_obj_t *widget, const struct status_state *state) {
-    lv_obj_t *canvas = lv_obj_get_child(widget, 2);
+static void draw_bottom(lv_obj_t *widget, const struct status_state *state, uint32_t dirty) {
+    if (!(dirty & STATUS_DIRTY_LAYER)) {
+        return;
+    }
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_LAYER_CACHE)
+    struct layer_cache_entry *entry = layer_cache_slot(state);
+    if (entry != NULL && entry->valid) {
+        canvas_load_pixels(lv_obj_get_child(widget, 2), entry->pixels);
+        return;
+    }
+#endif
+
+    lv_obj_t *canvas = canvas_scratch();
 
-    lv_draw_rect_dsc_t rect_black_dsc;
-    init_rect_dsc(&rect_black_dsc, LVGL_BACKGROUND);
     lv_draw_label_dsc_t label_dsc;
-    init_label_dsc(&label_dsc, LVGL_FOREGROUND, &lv_font_montserrat_14, LV_TEXT_ALIGN_CENTER);
+    init_label_dsc(&label_dsc, LVGL_FOREGROUND, FONT_MONTSERRAT_14, LV_TEXT_ALIGN_CENTER);
 
     // Fill background
-    lv_canvas_fill_bg(canvas, LVGL_BACKGROUND, LV_OPA_COVER);
+    canvas_scratch_clear(&full_area);
+
+    canvas_begin(canvas);
 
     // Draw layer
     if (state->layer_label == NULL || strlen(state->layer_label) == 0) {
-        char text[10] = {};
+        if (!canvas_blit_number(canvas, &layer_digits, 0, 0, 72, LV_TEXT_ALIGN_CENTER,
+                                state->layer_index)) {
+            char text[10] = {};
 
-        sprintf(text, "LAYER %i", state->layer_index);
+            sprintf(text, "LAYER %i", state->layer_index);
 
-        canvas_draw_text(canvas, 0, 0, 72, &label_dsc, text);
+            canvas_draw_text(canvas, 0, 0, 72, &label_dsc, text);
+        }
     } else {
         canvas_draw_text(canvas, 0, 0, 72, &label_dsc, state->layer_label);
     }
 
-    // Rotate canvas
-    rotate_canvas(canvas);
+    canvas_finish(canvas);
+
+    // Rotate canvas into place
+    canvas_rotate_area(lv_obj_get_child(widget, 2), &full_area);
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_LAYER_CACHE)
+    if (entry != NULL) {
+        canvas_save_pixels(lv_obj_get_child(widget, 2), entry->pixels);
+        entry->valid = true;
+    }
+#endif
+}
+#endif /* !IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_RENDERER_LEAN) */
+
+// Renders the changes selected by `mask`; the others stay pending for a later
+// frame. Returns false if there was nothing to draw.
+static bool render_status(uint32_t mask) {
+    store.seq = state_read(&store.state);
+
+    uint32_t dirty = store.dirty | status_state_diff(&store.rendered, &store.state);
+
+    if (dirty != STATUS_DIRTY_ALL) {
+        dirty &= mask;
+    }
+    if (dirty == 0) {
+        return false;
+    }
+
+    profile_time_t frame = profile_start();
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_RENDERER_LEAN)
+    int16_t y1, y2;
+    if (lean_status_render(store.frame.fb, &store.state, dirty, &y1, &y2)) {
+        display_flush_frame(&store.frame.fb[0][0], LEAN_STRIDE, y1, y2);
+        bench_flushed((y2 - y1 + 1) * LEAN_STRIDE);
+    }
+#else
+    profile_time_t start = profile_start();
+    draw_top(store.obj, &store.state, &store.rendered, dirty);
+    profile_stop(PROFILE_DRAW_TOP, start);
+    start = profile_start();
+    draw_middle(store.obj, &store.state, dirty);
+    profile_stop(PROFILE_DRAW_MIDDLE, start);
+    start = profile_start();
+    draw_bottom(store.obj, &store.state, dirty);
+    profile_stop(PROFILE_DRAW_BOTTOM, start);
+    frame_arena_end_frame();
+#endif
+    profile_stop(PROFILE_FRAME, frame);
+
+    status_state_commit(&store.rendered, &store.state, dirty);
+    store.dirty &= ~dirty;
+
+    return true;
+}
+
+static uint32_t latency_events(uint32_t mask) {
+    return ((mask & STATUS_DIRTY_LAYER) ? BIT(LATENCY_LAYER) : 0) |
+           ((mask & STATUS_DIRTY_WPM) ? BIT(LATENCY_WPM) : 0) |
+           ((mask & STATUS_DIRTY_BATTERY) ? BIT(LATENCY_BATTERY) : 0) |
+           ((mask & (STATUS_DIRTY_OUTPUT | STATUS_DIRTY_PROFILES)) ? BIT(LATENCY_OUTPUT) : 0);
+}
+
+static void render_widgets(uint32_t mask) {
+    bool drawn = store.obj != NULL && render_status(mask);
+
+    // Events that changed no pixels are done as soon as that is known
+    latency_rendered(latency_events(mask));
+    if (!drawn) {
+        latency_flushed();
+    }
 }
 
-static void set_battery_status(struct zmk_widget_status *widget,
-                               struct battery_status_state state) {
+static void render_frame(struct k_work *work) {
+    atomic_set(&last_frame_time, k_uptime_get_32());
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_PAUSE_WHEN_IDLE)
+    if (atomic_get(&paused)) {
+        // Like schedule_frame(), for a frame scheduled just before the pause.
+        // With nothing to draw, it is skipped, as render_status() does a full
+        // redraw whatever the mask.
+        latency_discard(latency_events(STATUS_DIRTY_ALL & ~STATUS_PAUSED));
+        if (STATUS_PAUSED != 0) {
+            render_widgets(STATUS_PAUSED);
+        }
+        return;
+    }
+#endif
+
+    render_widgets(STATUS_DIRTY_ALL);
+}
+
+// Renders only the urgent changes, which then go out with the next display
+// refresh. Anything else stays for the regular frame. If that frame got there
+// first, there is nothing left to do here.
+static void render_urgent_frame(struct k_work *work) {
+    render_widgets(STATUS_URGENT);
+
+    if (store.obj == NULL || store.dirty != 0 ||
+        status_state_diff(&store.rendered, &store.state) != 0) {
+        return;
+    }
+
+    // A regular frame scheduled by an earlier change was drawn here as well and
+    // would find nothing left. A change published since the snapshot may have
+    // scheduled it again, so that frame is put back.
+    k_work_cancel_delayable(&render_work);
+    if (atomic_get(&live.seq) != store.seq) {
+        schedule_frame(0);
+    }
+}
+
+// State setters run in the context of their events and only record the new
+// state; everything that changed before the next frame is due gets rendered
+// together. Scheduling an already scheduled
+// frame is a no-op, so bursts of events collapse into one render. Urgent
+// changes bypass the frame rate limit.
+static void schedule_frame(uint32_t changed) {
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_PAUSE_WHEN_IDLE)
+    if (atomic_get(&paused)) {
+        latency_discard(latency_events(changed & ~STATUS_PAUSED));
+        if ((changed & STATUS_PAUSED) == 0) {
+            return;
+        }
+        changed = STATUS_PAUSED;
+    }
+#endif
+
+    if (changed & STATUS_URGENT) {
+        k_work_submit_to_queue(zmk_display_work_q(), &urgent_work);
+        return;
+    }
+
+    int32_t delay =
+        (int32_t)((uint32_t)atomic_get(&last_frame_time) + FRAME_INTERVAL_MS - k_uptime_get_32());
+
+    k_work_schedule_for_queue(zmk_display_work_q(), &render_work, K_MSEC(MAX(delay, 0)));
+}
+
+static uint32_t set_battery_status(struct battery_status_state state) {
+    k_spinlock_key_t key;
+    struct status_state *s = state_write_begin(&key);
+
 #if IS_ENABLED(CONFIG_USB_DEVICE_STACK)
-    widget->state.charging = state.usb_present;
+    s->charging = state.usb_present;
 #endif /* IS_ENABLED(CONFIG_USB_DEVICE_STACK) */
 
-    widget->state.battery = state.level;
+    s->battery = state.level;
 
-    draw_top(widget->obj, &widget->state);
+    state_write_end(key);
+    return STATUS_DIRTY_BATTERY;
 }
 
-static void battery_status_update_cb(struct battery_status_state state) {
-    struct zmk_widget_status *widget;
-    SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) { set_battery_status(widget, state); }
+static uint32_t battery_status_update_cb(struct battery_status_state state) {
+    return set_battery_status(state);
 }
 
 static struct battery_status_state battery_status_get_state(const zmk_event_t *eh) {
@@ -231,50 +769,69 @@ static struct battery_status_state battery_status_get_state(const zmk_event_t *e
     };
 }
 
-ZMK_DISPLAY_WIDGET_LISTENER(widget_battery_status, struct battery_status_state,
-                            battery_status_update_cb, battery_status_get_state)
+NICE_VIEW_WIDGET_PUBLISHER(widget_battery_status, struct battery_status_state,
+                           battery_status_update_cb, schedule_frame, battery_status_get_state,
+                           battery_status_visible, LATENCY_BATTERY)
 
 ZMK_SUBSCRIPTION(widget_battery_status, zmk_battery_state_changed);
 #if IS_ENABLED(CONFIG_USB_DEVICE_STACK)
 ZMK_SUBSCRIPTION(widget_battery_status, zmk_usb_conn_state_changed);
 #endif /* IS_ENABLED(CONFIG_USB_DEVICE_STACK) */
 
-static void set_output_status(struct zmk_widget_status *widget,
-                              const struct output_status_state *state) {
-    widget->state.selected_endpoint = state->selected_endpoint;
-    widget->state.active_profile_index = state->active_profile_index;
-    widget->state.active_profile_connected = state->active_profile_connected;
-    widget->state.active_profile_bonded = state->active_profile_bonded;
+static uint32_t set_output_status(const struct output_status_state *state) {
+    k_spinlock_key_t key;
+    struct status_state *s = state_write_begin(&key);
+
+    s->selected_endpoint = state->selected_endpoint;
+    s->active_profile_index = state->active_profile_index;
+    s->active_profile_connected = state->active_profile_connected;
+    s->active_profile_bonded = state->active_profile_bonded;
     for (int i = 0; i < NICEVIEW_PROFILE_COUNT; ++i) {
-        widget->state.profiles_connected[i] = state->profiles_connected[i];
-        widget->state.profiles_bonded[i] = state->profiles_bonded[i];
+        s->profiles_connected[i] = state->profiles_connected[i];
+        s->profiles_bonded[i] = state->profiles_bonded[i];
     }
 
-    draw_top(widget->obj, &widget->state);
-    draw_middle(widget->obj, &widget->state);
+    state_write_end(key);
+    return STATUS_DIRTY_OUTPUT | STATUS_DIRTY_PROFILES;
 }
 
-static void output_status_update_cb(struct output_status_state state) {
-    struct zmk_widget_status *widget;
-    SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) { set_output_status(widget, &state); }
+static uint32_t output_status_update_cb(struct output_status_state state) {
+    return set_output_status(&state);
 }
 
-static struct output_status_state output_status_get_state(const zmk_event_t *_eh) {
+static struct output_status_state output_status_get_state(const zmk_event_t *eh) {
     struct output_status_state state = {
         .selected_endpoint = zmk_endpoint_get_selected(),
-        .active_profile_index = zmk_ble_active_profile_index(),
-        .active_profile_connected = zmk_ble_active_profile_is_connected(),
-        .active_profile_bonded = !zmk_ble_active_profile_is_open(),
     };
+    // Without BLE, as on native_sim, every profile shows as open
+#if IS_ENABLED(CONFIG_ZMK_BLE)
+    state.active_profile_index = zmk_ble_active_profile_index();
+    state.active_profile_connected = zmk_ble_active_profile_is_connected();
+    state.active_profile_bonded = !zmk_ble_active_profile_is_open();
     for (int i = 0; i < MIN(NICEVIEW_PROFILE_COUNT, ZMK_BLE_PROFILE_COUNT); ++i) {
         state.profiles_connected[i] = zmk_ble_profile_is_connected(i);
         state.profiles_bonded[i] = !zmk_ble_profile_is_open(i);
     }
+#endif
     return state;
 }
 
-ZMK_DISPLAY_WIDGET_LISTENER(widget_output_status, struct output_status_state,
-                            output_status_update_cb, output_status_get_state)
+// Endpoint and profile events also fire for changes the screen does not show,
+// such as the BLE address of a profile or a reconnect to the same endpoint
+static bool output_status_visible(const struct output_status_state *prev,
+                                  struct output_status_state *next) {
+    return prev->selected_endpoint.transport != next->selected_endpoint.transport ||
+           prev->active_profile_index != next->active_profile_index ||
+           prev->active_profile_connected != next->active_profile_connected ||
+           prev->active_profile_bonded != next->active_profile_bonded ||
+           memcmp(prev->profiles_connected, next->profiles_connected,
+                  sizeof(next->profiles_connected)) != 0 ||
+           memcmp(prev->profiles_bonded, next->profiles_bonded, sizeof(next->profiles_bonded)) != 0;
+}
+
+NICE_VIEW_WIDGET_PUBLISHER(widget_output_status, struct output_status_state,
+                           output_status_update_cb, schedule_frame, output_status_get_state,
+                           output_status_visible, LATENCY_OUTPUT)
 ZMK_SUBSCRIPTION(widget_output_status, zmk_endpoint_changed);
 
 #if IS_ENABLED(CONFIG_USB_DEVICE_STACK)
@@ -284,16 +841,19 @@ ZMK_SUBSCRIPTION(widget_output_status, zmk_usb_conn_state_changed);
 ZMK_SUBSCRIPTION(widget_output_status, zmk_ble_active_profile_changed);
 #endif
 
-static void set_layer_status(struct zmk_widget_status *widget, struct layer_status_state state) {
-    widget->state.layer_index = state.index;
-    widget->state.layer_label = state.label;
+static uint32_t set_layer_status(struct layer_status_state state) {
+    k_spinlock_key_t key;
+    struct status_state *s = state_write_begin(&key);
 
-    draw_bottom(widget->obj, &widget->state);
+    s->layer_index = state.index;
+    s->layer_label = state.label;
+
+    state_write_end(key);
+    return STATUS_DIRTY_LAYER;
 }
 
-static void layer_status_update_cb(struct layer_status_state state) {
-    struct zmk_widget_status *widget;
-    SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) { set_layer_status(widget, state); }
+static uint32_t layer_status_update_cb(struct layer_status_state state) {
+    return set_layer_status(state);
 }
 
 static struct layer_status_state layer_status_get_state(const zmk_event_t *eh) {
@@ -302,51 +862,420 @@ static struct layer_status_state layer_status_get_state(const zmk_event_t *eh) {
         .index = index, .label = zmk_keymap_layer_name(zmk_keymap_layer_index_to_id(index))};
 }
 
-ZMK_DISPLAY_WIDGET_LISTENER(widget_layer_status, struct layer_status_state, layer_status_update_cb,
-                            layer_status_get_state)
+// Layers below the highest active one come and go without changing the name
+static bool layer_status_visible(const struct layer_status_state *prev,
+                                 struct layer_status_state *next) {
+    return prev->index != next->index || !labels_equal(prev->label, next->label);
+}
+
+NICE_VIEW_WIDGET_PUBLISHER(widget_layer_status, struct layer_status_state, layer_status_update_cb,
+                           schedule_frame, layer_status_get_state, layer_status_visible,
+                           LATENCY_LAYER)
 
 ZMK_SUBSCRIPTION(widget_layer_status, zmk_layer_state_changed);
 
-static void set_wpm_status(struct zmk_widget_status *widget, struct wpm_status_state state) {
-    for (int i = 0; i < 9; i++) {
-        widget->state.wpm[i] = widget->state.wpm[i + 1];
+static uint8_t wpm_scan(const struct status_state *state, bool max) {
+    uint8_t found = state->wpm[0];
+    for (int i = 1; i < WPM_HISTORY; i++) {
+        if (max ? state->wpm[i] > found : state->wpm[i] < found) {
+            found = state->wpm[i];
+        }
+    }
+    return found;
+}
+
+static uint32_t set_wpm_status(struct wpm_status_state state) {
+    k_spinlock_key_t key;
+    struct status_state *s = state_write_begin(&key);
+    uint8_t evicted = s->wpm[s->wpm_head];
+
+    s->wpm[s->wpm_head] = state.wpm;
+    s->wpm_head = (s->wpm_head + 1) % WPM_HISTORY;
+    s->wpm_samples++;
+
+    // Only rescan the history when the evicted sample was the extreme, which
+    // bounds the work under the lock to one pass over WPM_HISTORY bytes
+    if (state.wpm >= s->wpm_max) {
+        s->wpm_max = state.wpm;
+    } else if (evicted == s->wpm_max) {
+        s->wpm_max = wpm_scan(s, true);
+    }
+    if (state.wpm <= s->wpm_min) {
+        s->wpm_min = state.wpm;
+    } else if (evicted == s->wpm_min) {
+        s->wpm_min = wpm_scan(s, false);
     }
-    widget->state.wpm[9] = state.wpm;
 
-    draw_top(widget->obj, &widget->state);
+    state_write_end(key);
+    return STATUS_DIRTY_WPM;
 }
 
-static void wpm_status_update_cb(struct wpm_status_state state) {
-    struct zmk_widget_status *widget;
-    SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) { set_wpm_status(widget, state); }
+static uint32_t wpm_status_update_cb(struct wpm_status_state state) {
+    return set_wpm_status(state);
 }
 
 struct wpm_status_state wpm_status_get_state(const zmk_event_t *eh) {
     return (struct wpm_status_state){.wpm = zmk_wpm_get_state()};
 };
 
-ZMK_DISPLAY_WIDGET_LISTENER(widget_wpm_status, struct wpm_status_state, wpm_status_update_cb,
-                            wpm_status_get_state)
+// Changes within the deadband of the last value shown are shown as that value,
+// and the band widens by the hysteresis when the value turns around. A drop to
+// zero always shows. Once the whole history holds the same value, more samples
+// of it change nothing on screen and are dropped.
+static bool wpm_status_visible(const struct wpm_status_state *prev,
+                               struct wpm_status_state *next) {
+    const int delta = next->wpm - prev->wpm;
+    const bool reverses = (delta > 0 && prev->trend < 0) || (delta < 0 && prev->trend > 0);
+    const int band = CONFIG_NICE_VIEW_WIDGET_WPM_DEADBAND +
+                     (reverses ? CONFIG_NICE_VIEW_WIDGET_WPM_HYSTERESIS : 0);
+
+    if (next->wpm != 0 && abs(delta) <= band) {
+        next->wpm = prev->wpm;
+    }
+
+    if (next->wpm == prev->wpm) {
+        next->trend = prev->trend;
+        next->repeats = MIN(prev->repeats + 1, WPM_HISTORY + 1);
+    } else {
+        next->trend = next->wpm > prev->wpm ? 1 : -1;
+        next->repeats = 1;
+    }
+
+    return next->repeats <= WPM_HISTORY;
+}
+
+NICE_VIEW_WIDGET_PUBLISHER(widget_wpm_status, struct wpm_status_state, wpm_status_update_cb,
+                           schedule_frame, wpm_status_get_state, wpm_status_visible, LATENCY_WPM)
 ZMK_SUBSCRIPTION(widget_wpm_status, zmk_wpm_state_changed);
 
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_PAUSE_WHEN_IDLE)
+struct activity_status_state {
+    enum zmk_activity_state state;
+};
+
+static void activity_status_update_cb(struct activity_status_state state) {
+    const bool paused_now = state.state != ZMK_ACTIVITY_ACTIVE;
+    const bool was_paused = atomic_set(&paused, paused_now);
+
+    // A single regular frame catches up with everything that changed meanwhile
+    if (was_paused && !paused_now) {
+        schedule_frame(0);
+    }
+}
+
+static struct activity_status_state activity_status_get_state(const zmk_event_t *eh) {
+    const struct zmk_activity_state_changed *ev = as_zmk_activity_state_changed(eh);
+
+    return (struct activity_status_state){
+        .state = (ev != NULL) ? ev->state : zmk_activity_get_state(),
+    };
+}
+
+ZMK_DISPLAY_WIDGET_LISTENER(widget_activity_status, struct activity_status_state,
+                            activity_status_update_cb, activity_status_get_state)
+ZMK_SUBSCRIPTION(widget_activity_status, zmk_activity_state_changed);
+#endif /* IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_PAUSE_WHEN_IDLE) */
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_BENCH)
+// Feeds scripted events to the same setters the ZMK listeners use, so the
+// benchmark needs no real keyboard, BLE or battery state
+void zmk_widget_status_bench_apply(const struct bench_event *event) {
+    switch (event->type) {
+    case BENCH_EVENT_WPM:
+        schedule_frame(set_wpm_status((struct wpm_status_state){.wpm = event->value}));
+        break;
+    case BENCH_EVENT_LAYER:
+        schedule_frame(set_layer_status((struct layer_status_state){.index = event->value}));
+        break;
+    case BENCH_EVENT_PROFILE: {
+        struct status_state current;
+        state_read(&current);
+
+        struct output_status_state state = {
+            .selected_endpoint = current.selected_endpoint,
+            .active_profile_index = event->value,
+            .active_profile_connected = true,
+            .active_profile_bonded = true,
+        };
+        for (int i = 0; i < NICEVIEW_PROFILE_COUNT; ++i) {
+            state.profiles_connected[i] = i == event->value;
+            state.profiles_bonded[i] = true;
+        }
+        schedule_frame(set_output_status(&state));
+        break;
+    }
+    case BENCH_EVENT_BATTERY:
+        schedule_frame(set_battery_status((struct battery_status_state){.level = event->value}));
+        break;
+    }
+}
+
+void zmk_widget_status_bench_render(void) { render_frame(NULL); }
+#endif /* IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_BENCH) */
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_SNAPSHOT)
+// The last frame is saved when the keyboard goes to deep sleep, which ends in
+// a cold boot, and shown again while the event sources report in. The save
+// runs on the display work queue between frames, so the canvases and the
+// rendered state match.
+#define SNAPSHOT_KEY "lpm_view/snapshot"
+#define SNAPSHOT_VERSION 2
+
+// The state a saved frame shows, without padding or pointers. The layer name
+// is left out; the live one replaces it after boot.
+struct snapshot_state {
+    uint8_t battery;
+    uint8_t charging;
+    uint8_t transport;
+    uint8_t active_profile_index;
+    uint8_t active_profile_connected;
+    uint8_t active_profile_bonded;
+    uint8_t profiles_connected;
+    uint8_t profiles_bonded;
+    uint8_t layer_index;
+    uint8_t wpm[WPM_HISTORY];
+    uint8_t wpm_head;
+    uint8_t wpm_min;
+    uint8_t wpm_max;
+    uint32_t wpm_samples;
+} __packed;
+
+BUILD_ASSERT(NICEVIEW_PROFILE_COUNT <= 8, "Profile flags must fit in a byte");
+
+// Saved under SNAPSHOT_KEY "/state"; the frame pixels are saved on their own
+// under SNAPSHOT_KEY "/frame". A version of 0 marks a missing snapshot.
+struct snapshot_record {
+    uint8_t version;
+    // Over the packed state and the frame pixels
+    uint32_t crc;
+    struct snapshot_state state;
+} __packed;
+
+// CRC of the last saved or loaded snapshot, so an unchanged frame is not
+// written again
+static uint32_t snapshot_saved_crc;
+static bool snapshot_saved;
+
+static void snapshot_pack(struct snapshot_state *out, const struct status_state *state) {
+    memset(out, 0, sizeof(*out));
+    out->battery = state->battery;
+    out->charging = state->charging;
+    out->transport = state->selected_endpoint.transport;
+    out->active_profile_index = state->active_profile_index;
+    out->active_profile_connected = state->active_profile_connected;
+    out->active_profile_bonded = state->active_profile_bonded;
+    for (int i = 0; i < NICEVIEW_PROFILE_COUNT; i++) {
+        out->profiles_connected |= state->profiles_connected[i] << i;
+        out->profiles_bonded |= state->profiles_bonded[i] << i;
+    }
+    out->layer_index = state->layer_index;
+    memcpy(out->wpm, state->wpm, sizeof(out->wpm));
+    out->wpm_head = state->wpm_head;
+    out->wpm_min = state->wpm_min;
+    out->wpm_max = state->wpm_max;
+    out->wpm_samples = state->wpm_samples;
+}
+
+static void snapshot_unpack(struct status_state *out, const struct snapshot_state *state) {
+    memset(out, 0, sizeof(*out));
+    out->battery = state->battery;
+    out->charging = state->charging;
+    out->selected_endpoint.transport = state->transport;
+    out->active_profile_index = state->active_profile_index;
+    out->active_profile_connected = state->active_profile_connected;
+    out->active_profile_bonded = state->active_profile_bonded;
+    for (int i = 0; i < NICEVIEW_PROFILE_COUNT; i++) {
+        out->profiles_connected[i] = state->profiles_connected & BIT(i);
+        out->profiles_bonded[i] = state->profiles_bonded & BIT(i);
+    }
+    out->layer_index = state->layer_index;
+    memcpy(out->wpm, state->wpm, sizeof(out->wpm));
+    out->wpm_head = state->wpm_head;
+    out->wpm_min = state->wpm_min;
+    out->wpm_max = state->wpm_max;
+    out->wpm_samples = state->wpm_samples;
+}
+
+static uint32_t snapshot_crc(const struct snapshot_state *state, const struct status_frame *frame) {
+    const uint32_t crc = crc32_ieee((const uint8_t *)state, sizeof(*state));
+
+    return crc32_ieee_update(crc, (const uint8_t *)frame, sizeof(*frame));
+}
+
+static void snapshot_save(void) {
+    struct snapshot_record record = {.version = SNAPSHOT_VERSION};
+
+    if (store.obj == NULL) {
+        return;
+    }
+
+    snapshot_pack(&record.state, &store.rendered);
+    record.crc = snapshot_crc(&record.state, &store.frame);
+    if (snapshot_saved && record.crc == snapshot_saved_crc) {
+        return;
+    }
+
+    int err = settings_save_one(SNAPSHOT_KEY "/frame", &store.frame, sizeof(store.frame));
+    if (err == 0) {
+        err = settings_save_one(SNAPSHOT_KEY "/state", &record, sizeof(record));
+    }
+    if (err < 0) {
+        LOG_WRN("Failed to save the status snapshot (%d)", err);
+        return;
+    }
+
+    snapshot_saved_crc = record.crc;
+    snapshot_saved = true;
+}
+
+struct snapshot_load {
+    struct snapshot_record record;
+    struct status_frame *frame;
+    bool has_frame;
+};
+
+static int snapshot_load_cb(const char *key, size_t len, settings_read_cb read_cb, void *cb_arg,
+                            void *param) {
+    struct snapshot_load *load = param;
+
+    if (key == NULL) {
+        return 0;
+    }
+    if (strcmp(key, "state") == 0 && len == sizeof(load->record)) {
+        if (read_cb(cb_arg, &load->record, len) != len) {
+            load->record.version = 0;
+        }
+    } else if (strcmp(key, "frame") == 0 && len == sizeof(*load->frame)) {
+        load->has_frame = read_cb(cb_arg, load->frame, len) == len;
+    }
+    return 0;
+}
+
+// Loads the saved frame into the canvases and the state it shows into
+// `rendered`. Returns false, with the frame cleared, if there is no valid
+// snapshot.
+static bool snapshot_load(struct status_frame *frame, struct status_state *rendered) {
+    struct snapshot_load load = {.frame = frame};
+
+    settings_subsys_init();
+    settings_load_subtree_direct(SNAPSHOT_KEY, snapshot_load_cb, &load);
+    if (!load.has_frame || load.record.version != SNAPSHOT_VERSION ||
+        load.record.crc != snapshot_crc(&load.record.state, frame)) {
+        memset(frame, 0, sizeof(*frame));
+        return false;
+    }
+
+    snapshot_unpack(rendered, &load.record.state);
+    snapshot_saved_crc = load.record.crc;
+    snapshot_saved = true;
+    return true;
+}
+
+static void snapshot_save_work(struct k_work *work) { snapshot_save(); }
+
+static K_WORK_DEFINE(snapshot_work, snapshot_save_work);
+
+static int snapshot_listener(const zmk_event_t *eh) {
+    const struct zmk_activity_state_changed *ev = as_zmk_activity_state_changed(eh);
+
+    if (ev == NULL || ev->state != ZMK_ACTIVITY_SLEEP) {
+        return ZMK_EV_EVENT_BUBBLE;
+    }
+
+    // Power goes off once the event is handled, so the save is waited for,
+    // unless the event already runs on the display work queue
+    if (k_current_get() == k_work_queue_thread_get(zmk_display_work_q())) {
+        snapshot_save();
+    } else {
+        struct k_work_sync sync;
+
+        k_work_submit_to_queue(zmk_display_work_q(), &snapshot_work);
+        k_work_flush(&snapshot_work, &sync);
+    }
+    return ZMK_EV_EVENT_BUBBLE;
+}
+
+ZMK_LISTENER(widget_status_snapshot, snapshot_listener);
+ZMK_SUBSCRIPTION(widget_status_snapshot, zmk_activity_state_changed);
+#endif /* IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_SNAPSHOT) */
+
 int zmk_widget_status_init(struct zmk_widget_status *widget, lv_obj_t *parent) {
+    const bool first = store.obj == NULL;
+
+    if (first) {
+        // Nothing has been rendered yet, so the first frame repaints everything,
+        // unless the last frame before deep sleep is shown again. Then only what
+        // the live state changes is redrawn.
+        store.dirty = STATUS_DIRTY_ALL;
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_SNAPSHOT)
+        if (snapshot_load(&store.frame, &store.rendered)) {
+            k_spinlock_key_t key;
+            *state_write_begin(&key) = store.rendered;
+            state_write_end(key);
+            store.dirty = 0;
+        }
+#endif
+    }
+
     widget->obj = lv_obj_create(parent);
     lv_obj_set_size(widget->obj, 144, 72);
+    // The canvases are aligned to the panel edges, which the lean renderer's
+    // views assume as well
+    lv_obj_set_style_pad_all(widget->obj, 0, LV_PART_MAIN);
+    lv_obj_set_style_border_width(widget->obj, 0, LV_PART_MAIN);
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_RENDERER_LEAN)
+    // The lean renderer writes the panel itself; LVGL only gets an empty object
+    if (!first) {
+        return 0;
+    }
+
+    lv_area_t content;
+    lv_obj_update_layout(widget->obj);
+    lv_obj_get_content_coords(widget->obj, &content);
+    __ASSERT(content.x1 == 0 && content.y1 == 0 && content.x2 == LEAN_WIDTH - 1 &&
+                 content.y2 == LEAN_HEIGHT - 1,
+             "Status widget does not cover the panel");
+
+    store.obj = widget->obj;
+    if (store.dirty == 0) {
+        display_flush_frame(&store.frame.fb[0][0], LEAN_STRIDE, 0, LEAN_HEIGHT - 1);
+    }
+#else
     lv_obj_t *top = lv_canvas_create(widget->obj);
     lv_obj_align(top, LV_ALIGN_BOTTOM_LEFT, 0, 0);
-    lv_canvas_set_buffer(top, widget->cbuf, CANVAS_SIZE, CANVAS_SIZE, CANVAS_COLOR_FORMAT);
+    canvas_set_buffer(top, store.frame.cbuf);
     lv_obj_t *middle = lv_canvas_create(widget->obj);
     lv_obj_align(middle, LV_ALIGN_TOP_LEFT, 58, 0);
-    lv_canvas_set_buffer(middle, widget->cbuf2, CANVAS_SIZE, CANVAS_SIZE, CANVAS_COLOR_FORMAT);
+    canvas_set_buffer(middle, store.frame.cbuf2);
     lv_obj_t *bottom = lv_canvas_create(widget->obj);
     lv_obj_align(bottom, LV_ALIGN_TOP_LEFT, 130, 0);
-    lv_canvas_set_buffer(bottom, widget->cbuf3, CANVAS_SIZE, CANVAS_SIZE, CANVAS_COLOR_FORMAT);
+    canvas_set_buffer(bottom, store.frame.cbuf3);
+
+    // Further instances only mirror the canvases of the first
+    if (!first) {
+        for (int i = 0; i < 3; i++) {
+            canvas_add_mirror(lv_obj_get_child(store.obj, i), lv_obj_get_child(widget->obj, i));
+        }
+        return 0;
+    }
+
+    store.obj = widget->obj;
+    canvas_scratch_init(widget->obj);
+    frame_arena_init(ARENA_FONT_SIZE);
+    glyph_atlas_init(&wpm_digits, FONT_UNSCII_8, NULL);
+    glyph_atlas_init(&layer_digits, FONT_MONTSERRAT_14, "LAYER ");
+#endif
 
-    sys_slist_append(&widgets, &widget->node);
     widget_battery_status_init();
     widget_output_status_init();
     widget_layer_status_init();
     widget_wpm_status_init();
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_PAUSE_WHEN_IDLE)
+    widget_activity_status_init();
+#endif
+
+    bench_run();
 
     return 0;
 }
@@ -10,14 +10,26 @@
 #include <lvgl.h>
 #include <zephyr/kernel.h>
 #include "util.h"
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_RENDERER_LEAN)
+#include "lean.h"
+#endif
 
-struct zmk_widget_status {
-    sys_snode_t node;
-    lv_obj_t *obj;
+// What is on screen: the canvas buffers, or the lean renderer's framebuffer.
+// Kept in one block so it can be saved before deep sleep and shown at boot.
+struct status_frame {
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_RENDERER_LEAN)
+    lean_fb_t fb;
+#else
     uint8_t cbuf[CANVAS_BUF_SIZE];
     uint8_t cbuf2[CANVAS_BUF_SIZE];
     uint8_t cbuf3[CANVAS_BUF_SIZE];
-    struct status_state state;
+#endif
+};
+
+// Instances only hold their LVGL objects. The state and the canvas buffers are
+// shared, so every instance shows the result of a single render.
+struct zmk_widget_status {
+    lv_obj_t *obj;
 };
 
 int zmk_widget_status_init(struct zmk_widget_status *widget, lv_obj_t *parent);
@@ -5,37 +5,282 @@
  *
  */
 
+#include <stdlib.h>
 #include <zephyr/kernel.h>
 #include "util.h"
+#include "bench.h"
+#include "profile.h"
+#include "mono.h"
+#include "frame_arena.h"
 
-LV_IMG_DECLARE(bolt);
+// Bytes of label text one batch holds, enough for the labels of a pass
+#define BATCH_TEXT_SIZE 96
 
-void rotate_canvas(lv_obj_t *canvas) {
-    uint8_t *buf = lv_canvas_get_draw_buf(canvas)->data;
-    static uint8_t buf_copy[CANVAS_BUF_SIZE];
-    memcpy(buf_copy, buf, sizeof(buf_copy));
+void canvas_set_buffer(lv_obj_t *canvas, uint8_t *buf) {
+    lv_canvas_set_buffer(canvas, buf, CANVAS_SIZE, CANVAS_SIZE, CANVAS_COLOR_FORMAT);
+    lv_canvas_set_palette(canvas, 0, lv_color_to_32(LVGL_BACKGROUND, LV_OPA_COVER));
+    lv_canvas_set_palette(canvas, 1, lv_color_to_32(LVGL_FOREGROUND, LV_OPA_COVER));
+}
+
+const uint16_t bolt_fill_rows[BOLT_H] = {
+    0x0000, 0x0400, 0x0400, 0x0c00, 0x0c00, 0x1c00, 0x1c00, 0x3c00, 0x3fc0,
+    0x7f80, 0x0780, 0x0700, 0x0700, 0x0600, 0x0600, 0x0400, 0x0400, 0x0000,
+};
+const uint16_t bolt_outline_rows[BOLT_H] = {
+    0x0600, 0x0a00, 0x0a00, 0x1200, 0x1200, 0x2200, 0x2200, 0x43e0, 0x4020,
+    0x8040, 0xf840, 0x0880, 0x0880, 0x0900, 0x0900, 0x0a00, 0x0a00, 0x0c00,
+};
+
+// The bolt rotated into canvas orientation at startup: row r is logical
+// column BOLT_X + BOLT_W - 1 - r, bit c logical row BOLT_Y + c
+#define BOLT_STRIDE DIV_ROUND_UP(BOLT_H, 8)
 
-    const uint32_t stride = lv_draw_buf_width_to_stride(CANVAS_SIZE, CANVAS_COLOR_FORMAT);
-    lv_draw_sw_rotate(buf_copy, buf, CANVAS_SIZE, CANVAS_SIZE, stride, stride,
-                      LV_DISPLAY_ROTATION_90, CANVAS_COLOR_FORMAT);
+static uint8_t bolt_fill[BOLT_W][BOLT_STRIDE];
+static uint8_t bolt_outline[BOLT_W][BOLT_STRIDE];
+
+static void bolt_rotate(uint8_t dst[BOLT_W][BOLT_STRIDE], const uint16_t *rows) {
+    for (int32_t r = 0; r < BOLT_W; r++) {
+        for (int32_t c = 0; c < BOLT_H; c++) {
+            if (rows[c] & (0x8000 >> (BOLT_W - 1 - r))) {
+                dst[r][c / 8] |= 0x80 >> (c % 8);
+            }
+        }
+    }
 }
 
-void draw_battery(lv_obj_t *canvas, const struct status_state *state) {
-    lv_draw_rect_dsc_t rect_black_dsc;
-    init_rect_dsc(&rect_black_dsc, LVGL_BACKGROUND);
-    lv_draw_rect_dsc_t rect_white_dsc;
-    init_rect_dsc(&rect_white_dsc, LVGL_FOREGROUND);
+// Hidden canvas that all drawing is rendered into before being rotated into
+// place. Each visible canvas is written exactly once per repaint, without a
+// copy of its previous contents.
+static lv_obj_t *scratch;
+static uint8_t scratch_buf[SCRATCH_BUF_SIZE];
+
+lv_obj_t *canvas_scratch_init(lv_obj_t *parent) {
+    if (scratch == NULL) {
+        scratch = lv_canvas_create(parent);
+        lv_obj_add_flag(scratch, LV_OBJ_FLAG_HIDDEN);
+        lv_canvas_set_buffer(scratch, scratch_buf, CANVAS_SIZE, CANVAS_SIZE, SCRATCH_COLOR_FORMAT);
+        bolt_rotate(bolt_fill, bolt_fill_rows);
+        bolt_rotate(bolt_outline, bolt_outline_rows);
+    }
+
+    return scratch;
+}
+
+lv_obj_t *canvas_scratch(void) { return scratch; }
+
+// Scratch pixels whose top bit differs from this are foreground
+#define SCRATCH_FOREGROUND_XOR (IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_INVERTED) ? 0 : UINT32_MAX)
+#define SCRATCH_BACKGROUND (IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_INVERTED) ? 0x00 : 0xff)
+
+// Fills an area of the scratch canvas with the background directly, which is a
+// memset per row instead of an LVGL fill task
+void canvas_scratch_clear(const lv_area_t *area) {
+    const lv_draw_buf_t *buf = lv_canvas_get_draw_buf(scratch);
+    const int32_t x1 = MAX(area->x1, 0);
+    const int32_t x2 = MIN(area->x2, CANVAS_SIZE - 1);
+
+    for (int32_t y = MAX(area->y1, 0); y <= MIN(area->y2, CANVAS_SIZE - 1); y++) {
+        memset(buf->data + y * buf->header.stride + x1, SCRATCH_BACKGROUND, MAX(x2 - x1 + 1, 0));
+    }
+}
+
+// Draws a one pixel wide polyline into the scratch canvas, limited to `clip`.
+// Plain Bresenham segments, set directly instead of queued as LVGL line tasks.
+void canvas_scratch_polyline(const lv_point_t points[], uint32_t point_cnt,
+                             const lv_area_t *clip) {
+    const lv_draw_buf_t *buf = lv_canvas_get_draw_buf(scratch);
+    const int32_t x_min = MAX(clip->x1, 0);
+    const int32_t x_max = MIN(clip->x2, CANVAS_SIZE - 1);
+    const int32_t y_min = MAX(clip->y1, 0);
+    const int32_t y_max = MIN(clip->y2, CANVAS_SIZE - 1);
+
+    for (uint32_t i = 1; i < point_cnt; i++) {
+        int32_t x = points[i - 1].x;
+        int32_t y = points[i - 1].y;
+        const int32_t dx = abs(points[i].x - x);
+        const int32_t dy = -abs(points[i].y - y);
+        const int32_t sx = x < points[i].x ? 1 : -1;
+        const int32_t sy = y < points[i].y ? 1 : -1;
+        int32_t err = dx + dy;
+
+        while (true) {
+            if (x >= x_min && x <= x_max && y >= y_min && y <= y_max) {
+                buf->data[y * buf->header.stride + x] = (uint8_t)~SCRATCH_BACKGROUND;
+            }
+            if (x == points[i].x && y == points[i].y) {
+                break;
+            }
+
+            const int32_t e2 = 2 * err;
+            if (e2 >= dy) {
+                err += dy;
+                x += sx;
+            }
+            if (e2 <= dx) {
+                err += dx;
+                y += sy;
+            }
+        }
+    }
+}
+
+// Rotates a scratch area into a packed buffer whose first row is canvas row
+// `row0` and whose first byte is canvas byte `byte0` of that row.
+static void rotate_into(uint8_t *dst, uint32_t dst_stride, int32_t row0, int32_t byte0,
+                        const lv_area_t *area) {
+    const lv_draw_buf_t *src = lv_canvas_get_draw_buf(scratch);
+    const struct mono_area rotated = {area->x1, area->y1, area->x2, area->y2};
+
+    mono_rotate_l8(dst, dst_stride, row0, byte0, src->data, src->header.stride, CANVAS_SIZE,
+                   &rotated, SCRATCH_BACKGROUND);
+}
+
+static inline uint8_t *canvas_pixels(lv_obj_t *canvas, uint32_t *stride) {
+    lv_draw_buf_t *buf = lv_canvas_get_draw_buf(canvas);
+
+    *stride = buf->header.stride;
+    return buf->data + CANVAS_PALETTE_SIZE;
+}
+
+void canvas_rotate_area(lv_obj_t *canvas, const lv_area_t *area) {
+    uint32_t stride;
+    uint8_t *px = canvas_pixels(canvas, &stride);
+
+    profile_time_t start = profile_start();
+    rotate_into(px, stride, 0, 0, area);
+    profile_stop(PROFILE_ROTATE, start);
+    canvas_invalidate_area(canvas, area);
+}
+
+// Canvases showing the same buffer as `canvas` are chained through their user
+// data, so whatever is drawn into it also refreshes them
+void canvas_add_mirror(lv_obj_t *canvas, lv_obj_t *mirror) {
+    lv_obj_set_user_data(mirror, lv_obj_get_user_data(canvas));
+    lv_obj_set_user_data(canvas, mirror);
+}
 
-    canvas_draw_rect(canvas, 0, 2, 29, 12, &rect_white_dsc);
-    canvas_draw_rect(canvas, 1, 3, 27, 10, &rect_black_dsc);
-    canvas_draw_rect(canvas, 2, 4, (state->battery + 2) / 4, 8, &rect_white_dsc);
-    canvas_draw_rect(canvas, 30, 5, 3, 6, &rect_white_dsc);
-    canvas_draw_rect(canvas, 31, 6, 1, 4, &rect_black_dsc);
+void canvas_invalidate_area(lv_obj_t *canvas, const lv_area_t *area) {
+    for (lv_obj_t *obj = canvas; obj != NULL; obj = lv_obj_get_user_data(obj)) {
+        lv_area_t coords;
+        lv_obj_get_coords(obj, &coords);
+        lv_area_t rotated = {
+            .x1 = coords.x1 + area->y1,
+            .y1 = coords.y1 + CANVAS_SIZE - 1 - area->x2,
+            .x2 = coords.x1 + area->y2,
+            .y2 = coords.y1 + CANVAS_SIZE - 1 - area->x1,
+        };
+        lv_obj_invalidate_area(obj, &rotated);
+    }
+    bench_flushed(DIV_ROUND_UP(lv_area_get_size(area), 8));
+}
+
+// Fills a logical area of a packed canvas, clipped to the canvas. Like the other
+// direct writes it does not invalidate; callers draw into areas they refresh.
+void canvas_fill_area(lv_obj_t *canvas, lv_coord_t x, lv_coord_t y, lv_coord_t w, lv_coord_t h,
+                      bool foreground) {
+    uint32_t stride;
+    uint8_t *px = canvas_pixels(canvas, &stride);
+    const int32_t x1 = MAX(x, 0);
+    const int32_t y1 = MAX(y, 0);
+    const int32_t x2 = MIN(x + w - 1, CANVAS_SIZE - 1);
+    const int32_t y2 = MIN(y + h - 1, CANVAS_SIZE - 1);
+
+    if (x1 > x2 || y1 > y2) {
+        return;
+    }
+
+    // Logical columns are canvas rows, bottom up
+    mono_fill_rect(px, stride, y1, CANVAS_SIZE - 1 - x2, y2 - y1 + 1, x2 - x1 + 1, foreground);
+}
+
+void canvas_clear_area(lv_obj_t *canvas, const lv_area_t *area) {
+    canvas_fill_area(canvas, area->x1, area->y1, lv_area_get_width(area), lv_area_get_height(area),
+                     false);
+}
+
+void canvas_scroll_area(lv_obj_t *canvas, const lv_area_t *area, int32_t dx) {
+    uint32_t stride;
+    uint8_t *px = canvas_pixels(canvas, &stride);
+    const int32_t rows = lv_area_get_width(area) - dx;
+
+    // Logical columns are canvas rows, so moving content left by dx copies each
+    // row from dx rows above it. The rightmost dx columns keep stale content.
+    if (rows > 0) {
+        mono_blit(px, stride, area->y1, CANVAS_SIZE - 1 - area->x2 + dx, px, stride, area->y1,
+                  CANVAS_SIZE - 1 - area->x2, lv_area_get_height(area), rows, MONO_OP_COPY);
+    }
+}
+
+void canvas_save_pixels(lv_obj_t *canvas, uint8_t *dst) {
+    uint32_t stride;
+    memcpy(dst, canvas_pixels(canvas, &stride), CANVAS_PIXELS_SIZE);
+}
+
+// Replaces the whole canvas with pixels kept by canvas_save_pixels()
+void canvas_load_pixels(lv_obj_t *canvas, const uint8_t *src) {
+    static const lv_area_t full_area = CANVAS_FULL_AREA;
+    uint32_t stride;
+
+    memcpy(canvas_pixels(canvas, &stride), src, CANVAS_PIXELS_SIZE);
+    canvas_invalidate_area(canvas, &full_area);
+}
+
+void canvas_pack_sprite(struct canvas_sprite *sprite, const lv_area_t *area) {
+    __ASSERT(lv_area_get_width(area) <= CANVAS_SPRITE_SIZE, "sprite too wide");
+    __ASSERT(lv_area_get_height(area) <= CANVAS_SPRITE_SIZE, "sprite too tall");
+
+    sprite->area = *area;
+    memset(sprite->bits, 0, sizeof(sprite->bits));
+    rotate_into(&sprite->bits[0][0], CANVAS_SPRITE_STRIDE, CANVAS_SIZE - 1 - area->x2,
+                area->y1 / 8, area);
+}
+
+void canvas_blit_sprite(lv_obj_t *canvas, const struct canvas_sprite *sprite) {
+    uint32_t stride;
+    uint8_t *px = canvas_pixels(canvas, &stride);
+    const int32_t row0 = CANVAS_SIZE - 1 - sprite->area.x2;
+    const int32_t byte0 = sprite->area.y1 / 8;
+    const int32_t bytes = sprite->area.y2 / 8 - byte0 + 1;
+
+    mono_blit(px, stride, byte0 * 8, row0, &sprite->bits[0][0], CANVAS_SPRITE_STRIDE, 0, 0,
+              bytes * 8, lv_area_get_width(&sprite->area), MONO_OP_OR);
+}
+
+void area_join(lv_area_t *dst, const lv_area_t *src) {
+    if (area_is_empty(dst)) {
+        *dst = *src;
+        return;
+    }
+
+    dst->x1 = MIN(dst->x1, src->x1);
+    dst->y1 = MIN(dst->y1, src->y1);
+    dst->x2 = MAX(dst->x2, src->x2);
+    dst->y2 = MAX(dst->y2, src->y2);
+}
+
+bool area_overlaps(const lv_area_t *a, const lv_area_t *b) {
+    return a->x1 <= b->x2 && b->x1 <= a->x2 && a->y1 <= b->y2 && b->y1 <= a->y2;
+}
+
+// Draws the battery straight into a packed canvas, over an area that has just
+// been cleared or rotated into place
+void draw_battery(lv_obj_t *canvas, const struct status_state *state) {
+    canvas_fill_area(canvas, 0, 2, 29, 12, true);
+    canvas_fill_area(canvas, 1, 3, 27, 10, false);
+    canvas_fill_area(canvas, 2, 4, battery_bar_width(state->battery), 8, true);
+    canvas_fill_area(canvas, 30, 5, 3, 6, true);
+    canvas_fill_area(canvas, 31, 6, 1, 4, false);
 
     if (state->charging) {
-        lv_draw_image_dsc_t img_dsc;
-        lv_draw_image_dsc_init(&img_dsc);
-        canvas_draw_img(canvas, 9, -1, &bolt, &img_dsc);
+        uint32_t stride;
+        uint8_t *px = canvas_pixels(canvas, &stride);
+        const int32_t row0 = CANVAS_SIZE - BOLT_X - BOLT_W;
+
+        // The bolt's first logical row is above the canvas and clipped off
+        mono_blit(px, stride, 0, row0, &bolt_outline[0][0], BOLT_STRIDE, -BOLT_Y, 0,
+                  BOLT_H + BOLT_Y, BOLT_W, MONO_OP_CLEAR);
+        mono_blit(px, stride, 0, row0, &bolt_fill[0][0], BOLT_STRIDE, -BOLT_Y, 0, BOLT_H + BOLT_Y,
+                  BOLT_W, MONO_OP_OR);
     }
 }
 
@@ -64,67 +309,278 @@ void init_arc_dsc(lv_draw_arc_dsc_t *arc_dsc, lv_color_t color, uint8_t width) {
     arc_dsc->width = width;
 }
 
+// Primitives drawn between canvas_begin() and canvas_finish() share one LVGL
+// layer and are dispatched together. The queue is flushed early once it holds
+// CONFIG_NICE_VIEW_WIDGET_DRAW_BATCH_SIZE draw tasks so a busy frame cannot
+// exhaust the LVGL heap. One batch is open at a time: beginning a batch, or
+// drawing outside one, finishes a batch left open on another canvas first, and
+// its canvas_finish() then has nothing left to do.
+static struct {
+    lv_obj_t *canvas;
+    lv_layer_t layer;
+    uint16_t queued;
+    bool single;
+    // Label text of the queued tasks, which LVGL reads when they are dispatched
+    uint16_t text_used;
+    char text[BATCH_TEXT_SIZE];
+} batch;
+
+static void batch_dispatch(lv_obj_t *canvas) {
+    profile_time_t start = profile_start();
+    lv_canvas_finish_layer(canvas, &batch.layer);
+    profile_stop(PROFILE_LAYER_DISPATCH, start);
+    batch.queued = 0;
+    batch.text_used = 0;
+}
+
+void canvas_finish(lv_obj_t *canvas) {
+    if (batch.canvas != canvas) {
+        return;
+    }
+
+    batch_dispatch(canvas);
+    batch.canvas = NULL;
+}
+
+void canvas_begin(lv_obj_t *canvas) {
+    if (batch.canvas != NULL) {
+        canvas_finish(batch.canvas);
+    }
+
+    batch.canvas = canvas;
+    batch.single = false;
+    lv_canvas_init_layer(canvas, &batch.layer);
+}
+
+static void batch_restart(lv_obj_t *canvas) {
+    batch_dispatch(canvas);
+    lv_canvas_init_layer(canvas, &batch.layer);
+}
+
+static void batch_sync(lv_obj_t *canvas) {
+    if (batch.canvas == canvas && batch.queued > 0) {
+        batch_restart(canvas);
+    }
+}
+
+static lv_layer_t *batch_layer(lv_obj_t *canvas) {
+    if (batch.canvas != canvas) {
+        canvas_begin(canvas);
+        batch.single = true;
+    }
+
+    return &batch.layer;
+}
+
+static void batch_queued(lv_obj_t *canvas, uint16_t count) {
+    frame_arena_count_tasks(count);
+
+    if (batch.single) {
+        canvas_finish(canvas);
+        return;
+    }
+
+    batch.queued += count;
+    if (batch.queued >= CONFIG_NICE_VIEW_WIDGET_DRAW_BATCH_SIZE) {
+        batch_restart(canvas);
+    }
+}
+
 void canvas_draw_line(lv_obj_t *canvas, const lv_point_t points[], uint32_t point_cnt,
                       lv_draw_line_dsc_t *draw_dsc) {
-    lv_layer_t layer;
-    lv_canvas_init_layer(canvas, &layer);
+    profile_time_t start = profile_start();
+    lv_layer_t *layer = batch_layer(canvas);
 
     for (uint32_t i = 1; i < point_cnt; ++i) {
         draw_dsc->p1.x = points[i - 1].x;
         draw_dsc->p1.y = points[i - 1].y;
         draw_dsc->p2.x = points[i].x;
         draw_dsc->p2.y = points[i].y;
-        lv_draw_line(&layer, draw_dsc);
+        lv_draw_line(layer, draw_dsc);
     }
 
-    lv_canvas_finish_layer(canvas, &layer);
+    profile_stop(PROFILE_DRAW_LINE, start);
+    batch_queued(canvas, point_cnt - 1);
 }
+
 void canvas_draw_rect(lv_obj_t *canvas, lv_coord_t x, lv_coord_t y, lv_coord_t w, lv_coord_t h,
                       lv_draw_rect_dsc_t *draw_dsc) {
-    lv_layer_t layer;
-    lv_canvas_init_layer(canvas, &layer);
+    profile_time_t start = profile_start();
+    lv_layer_t *layer = batch_layer(canvas);
 
     lv_area_t coords = {x, y, x + w - 1, y + h - 1};
-    lv_draw_rect(&layer, draw_dsc, &coords);
+    lv_draw_rect(layer, draw_dsc, &coords);
 
-    lv_canvas_finish_layer(canvas, &layer);
+    profile_stop(PROFILE_DRAW_RECT, start);
+    batch_queued(canvas, 1);
 }
 
 void canvas_draw_arc(lv_obj_t *canvas, lv_coord_t x, lv_coord_t y, lv_coord_t r,
                      int32_t start_angle, int32_t end_angle, lv_draw_arc_dsc_t *draw_dsc) {
-    lv_layer_t layer;
-    lv_canvas_init_layer(canvas, &layer);
+    profile_time_t start = profile_start();
+    lv_layer_t *layer = batch_layer(canvas);
 
     draw_dsc->center.x = x;
     draw_dsc->center.y = y;
     draw_dsc->radius = r;
     draw_dsc->start_angle = start_angle;
     draw_dsc->end_angle = end_angle;
-    lv_draw_arc(&layer, draw_dsc);
+    lv_draw_arc(layer, draw_dsc);
 
-    lv_canvas_finish_layer(canvas, &layer);
+    profile_stop(PROFILE_DRAW_ARC, start);
+    batch_queued(canvas, 1);
 }
 
 void canvas_draw_text(lv_obj_t *canvas, lv_coord_t x, lv_coord_t y, lv_coord_t max_w,
                       lv_draw_label_dsc_t *draw_dsc, const char *txt) {
-    lv_layer_t layer;
-    lv_canvas_init_layer(canvas, &layer);
+    profile_time_t start = profile_start();
+    lv_layer_t *layer = batch_layer(canvas);
 
+    // Callers pass stack buffers that are gone by the time a batch is
+    // dispatched, so queued labels get a copy that lives as long as the batch.
+    // Text that does not fit even after a dispatch is copied by LVGL instead.
+    const size_t len = strlen(txt) + 1;
     draw_dsc->text = txt;
+    draw_dsc->text_local = 0;
+    if (!batch.single) {
+        if (len > sizeof(batch.text) - batch.text_used && batch.queued > 0) {
+            batch_restart(canvas);
+        }
+        if (len <= sizeof(batch.text) - batch.text_used) {
+            draw_dsc->text = memcpy(batch.text + batch.text_used, txt, len);
+            batch.text_used += len;
+        } else {
+            draw_dsc->text_local = 1;
+        }
+    }
     lv_area_t coords = {x, y, x + max_w, y + CANVAS_SIZE};
-    lv_draw_label(&layer, draw_dsc, &coords);
+    lv_draw_label(layer, draw_dsc, &coords);
 
-    lv_canvas_finish_layer(canvas, &layer);
+    profile_stop(PROFILE_DRAW_TEXT, start);
+    batch_queued(canvas, 1);
 }
 
 void canvas_draw_img(lv_obj_t *canvas, lv_coord_t x, lv_coord_t y, const lv_image_dsc_t *src,
                      lv_draw_image_dsc_t *draw_dsc) {
-    lv_layer_t layer;
-    lv_canvas_init_layer(canvas, &layer);
+    profile_time_t start = profile_start();
+    lv_layer_t *layer = batch_layer(canvas);
 
     draw_dsc->src = src;
     lv_area_t coords = {x, y, x + src->header.w - 1, y + src->header.h - 1};
-    lv_draw_image(&layer, draw_dsc, &coords);
+    lv_draw_image(layer, draw_dsc, &coords);
+
+    profile_stop(PROFILE_DRAW_IMG, start);
+    batch_queued(canvas, 1);
+}
+
+void glyph_atlas_init(struct glyph_atlas *atlas, const lv_font_t *font, const char *prefix) {
+    static const lv_area_t full_area = CANVAS_FULL_AREA;
+    lv_obj_t *canvas = canvas_scratch();
+    const lv_draw_buf_t *src = lv_canvas_get_draw_buf(canvas);
+    const int32_t height = lv_font_get_line_height(font);
+
+    lv_draw_label_dsc_t label_dsc;
+    init_label_dsc(&label_dsc, LVGL_FOREGROUND, font, LV_TEXT_ALIGN_LEFT);
+
+    memset(atlas, 0, sizeof(*atlas));
+    atlas->has_prefix = prefix != NULL;
+    if (height > GLYPH_ATLAS_HEIGHT) {
+        return;
+    }
+
+    // Each entry is drawn alone into the scratch canvas and read back, so the
+    // atlas holds exactly what a label would have drawn
+    int32_t column = 0;
+    for (int i = 0; i < (atlas->has_prefix ? GLYPH_ATLAS_ENTRIES : GLYPH_ATLAS_PREFIX); i++) {
+        const char digit[2] = {'0' + i, '\0'};
+        const char *text = i == GLYPH_ATLAS_PREFIX ? prefix : digit;
+        const int32_t advance = lv_text_get_width(text, strlen(text), font, 0);
+        const int32_t width = advance + 2 * GLYPH_ATLAS_PAD;
+
+        if (column + width > GLYPH_ATLAS_WIDTH || width > CANVAS_SIZE) {
+            return;
+        }
+
+        canvas_scratch_clear(&full_area);
+        canvas_draw_text(canvas, GLYPH_ATLAS_PAD, 0, CANVAS_SIZE, &label_dsc, text);
+
+        for (int32_t y = 0; y < height; y++) {
+            const uint8_t *px = src->data + y * src->header.stride;
+            for (int32_t x = 0; x < width; x++) {
+                if ((px[x] ^ SCRATCH_FOREGROUND_XOR) & 0x80) {
+                    atlas->bits[y][(column + x) / 8] |= 0x80 >> ((column + x) % 8);
+                }
+            }
+        }
+
+        atlas->column[i] = column;
+        atlas->advance[i] = advance;
+        column += width;
+    }
+
+    atlas->height = height;
+}
+
+static void blit_glyph(const lv_draw_buf_t *dst, const struct glyph_atlas *atlas, int entry,
+                       int32_t x0, int32_t y0) {
+    const int32_t column = atlas->column[entry];
+    const int32_t width = atlas->advance[entry] + 2 * GLYPH_ATLAS_PAD;
+    const uint8_t foreground = SCRATCH_FOREGROUND_XOR & 0x80 ? 0x00 : 0xff;
+
+    for (int32_t y = MAX(0, -y0); y < atlas->height && y0 + y < CANVAS_SIZE; y++) {
+        uint8_t *px = dst->data + (y0 + y) * dst->header.stride + x0;
+        for (int32_t x = MAX(0, -x0); x < width && x0 + x < CANVAS_SIZE; x++) {
+            if (atlas->bits[y][(column + x) / 8] & (0x80 >> ((column + x) % 8))) {
+                px[x] = foreground;
+            }
+        }
+    }
+}
+
+// Draws the atlas prefix followed by `value` into the scratch canvas, laid out
+// like canvas_draw_text() with the same arguments. Returns false without
+// drawing if the atlas is unusable.
+bool canvas_blit_number(lv_obj_t *canvas, const struct glyph_atlas *atlas, lv_coord_t x,
+                        lv_coord_t y, lv_coord_t max_w, lv_text_align_t align, uint32_t value) {
+    if (atlas->height == 0) {
+        return false;
+    }
+
+    // Primitives queued before the number must land underneath it
+    batch_sync(canvas);
+
+    profile_time_t start = profile_start();
+
+    // Up to ten digits and the prefix, last digit first
+    uint8_t entries[GLYPH_ATLAS_ENTRIES];
+    int count = 0;
+    do {
+        entries[count++] = value % 10;
+        value /= 10;
+    } while (value > 0);
+    if (atlas->has_prefix) {
+        entries[count++] = GLYPH_ATLAS_PREFIX;
+    }
+
+    int32_t width = 0;
+    for (int i = 0; i < count; i++) {
+        width += atlas->advance[entries[i]];
+    }
+
+    // Same line placement as lv_draw_label() in an area max_w + 1 pixels wide
+    int32_t pen = x;
+    if (align == LV_TEXT_ALIGN_RIGHT) {
+        pen += max_w + 1 - width;
+    } else if (align == LV_TEXT_ALIGN_CENTER) {
+        pen += (max_w + 1 - width) / 2;
+    }
+
+    const lv_draw_buf_t *dst = lv_canvas_get_draw_buf(canvas);
+    for (int i = count - 1; i >= 0; i--) {
+        blit_glyph(dst, atlas, entries[i], pen - GLYPH_ATLAS_PAD, y);
+        pen += atlas->advance[entries[i]];
+    }
 
-    lv_canvas_finish_layer(canvas, &layer);
+    profile_stop(PROFILE_BLIT_NUMBER, start);
+    return true;
 }
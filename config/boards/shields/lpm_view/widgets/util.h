@@ -5,22 +5,70 @@
  *
  */
 
+#pragma once
+
 #include <lvgl.h>
+#include <zephyr/sys/util.h>
 #include <zmk/endpoints.h>
 
 #define NICEVIEW_PROFILE_COUNT 5
 
 #define CANVAS_SIZE 68
-#define CANVAS_COLOR_FORMAT LV_COLOR_FORMAT_L8 // smallest type supported by sw_rotate
+// Visible canvases are packed 1 bpp; index 0 is the background, 1 the foreground
+#define CANVAS_COLOR_FORMAT LV_COLOR_FORMAT_I1
+#define CANVAS_PALETTE_SIZE                                                                        \
+    (LV_COLOR_INDEXED_PALETTE_SIZE(CANVAS_COLOR_FORMAT) * sizeof(lv_color32_t))
 #define CANVAS_BUF_SIZE                                                                            \
-    LV_CANVAS_BUF_SIZE(CANVAS_SIZE, CANVAS_SIZE, LV_COLOR_FORMAT_GET_BPP(CANVAS_COLOR_FORMAT),     \
+    (LV_CANVAS_BUF_SIZE(CANVAS_SIZE, CANVAS_SIZE, LV_COLOR_FORMAT_GET_BPP(CANVAS_COLOR_FORMAT),    \
+                        LV_DRAW_BUF_STRIDE_ALIGN) +                                                \
+     CANVAS_PALETTE_SIZE)
+
+// Packed pixels of a visible canvas, without its palette
+#define CANVAS_PIXELS_SIZE (CANVAS_BUF_SIZE - CANVAS_PALETTE_SIZE)
+
+// LVGL draws into an 8 bpp scratch canvas that is packed while rotating
+#define SCRATCH_COLOR_FORMAT LV_COLOR_FORMAT_L8
+#define SCRATCH_BUF_SIZE                                                                           \
+    LV_CANVAS_BUF_SIZE(CANVAS_SIZE, CANVAS_SIZE, LV_COLOR_FORMAT_GET_BPP(SCRATCH_COLOR_FORMAT),    \
                        LV_DRAW_BUF_STRIDE_ALIGN)
 
+// Widgets draw with build-time subsets of the LVGL fonts when they are enabled
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_FONT_SUBSET)
+LV_FONT_DECLARE(lpm_font_montserrat_14);
+LV_FONT_DECLARE(lpm_font_montserrat_16);
+LV_FONT_DECLARE(lpm_font_montserrat_18);
+LV_FONT_DECLARE(lpm_font_unscii_8);
+#define FONT_MONTSERRAT_14 (&lpm_font_montserrat_14)
+#define FONT_MONTSERRAT_16 (&lpm_font_montserrat_16)
+#define FONT_MONTSERRAT_18 (&lpm_font_montserrat_18)
+#define FONT_UNSCII_8 (&lpm_font_unscii_8)
+#else
+#define FONT_MONTSERRAT_14 (&lv_font_montserrat_14)
+#define FONT_MONTSERRAT_16 (&lv_font_montserrat_16)
+#define FONT_MONTSERRAT_18 (&lv_font_montserrat_18)
+#define FONT_UNSCII_8 (&lv_font_unscii_8)
+#endif
+
 #define LVGL_BACKGROUND                                                                            \
     IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_INVERTED) ? lv_color_black() : lv_color_white()
 #define LVGL_FOREGROUND                                                                            \
     IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_INVERTED) ? lv_color_white() : lv_color_black()
 
+#define WPM_HISTORY CONFIG_NICE_VIEW_WIDGET_WPM_HISTORY
+// Horizontal distance between WPM graph samples
+#define WPM_STEP MAX(1, 63 / (WPM_HISTORY - 1))
+// Rows the graph spans inside the WPM box, which is drawn from row 21 to 52
+#define WPM_GRAPH_TOP 23
+#define WPM_GRAPH_BOTTOM 50
+
+// Row of a WPM sample, scaled so the history's minimum and maximum land on the
+// bottom and top rows of the graph
+static inline int32_t wpm_graph_y(uint8_t wpm, uint8_t min, uint8_t max) {
+    const int range = MAX(max - min, 1);
+
+    return WPM_GRAPH_BOTTOM - (wpm - min) * (WPM_GRAPH_BOTTOM - WPM_GRAPH_TOP) / range;
+}
+
 struct status_state {
     uint8_t battery;
     bool charging;
@@ -33,20 +81,96 @@ struct status_state {
     bool profiles_bonded[NICEVIEW_PROFILE_COUNT];
     uint8_t layer_index;
     const char *layer_label;
-    uint8_t wpm[10];
+    // Ring buffer of WPM samples; wpm_head is the oldest one
+    uint8_t wpm[CONFIG_NICE_VIEW_WIDGET_WPM_HISTORY];
+    uint8_t wpm_head;
+    uint8_t wpm_min;
+    uint8_t wpm_max;
+    uint32_t wpm_samples;
 #else
     bool connected;
 #endif
 };
 
-struct battery_status_state {
-    uint8_t level;
-#if IS_ENABLED(CONFIG_USB_DEVICE_STACK)
-    bool usb_present;
-#endif
+/* Sub-regions of the status canvases that can be repainted on their own */
+#define STATUS_DIRTY_BATTERY BIT(0)
+#define STATUS_DIRTY_OUTPUT BIT(1)
+#define STATUS_DIRTY_WPM BIT(2)
+#define STATUS_DIRTY_LAYER BIT(3)
+#define STATUS_DIRTY_PROFILE(i) BIT(4 + (i))
+#define STATUS_DIRTY_PROFILES (BIT_MASK(NICEVIEW_PROFILE_COUNT) << 4)
+#define STATUS_DIRTY_ALL UINT32_MAX
+
+#define AREA_EMPTY {1, 1, 0, 0}
+#define CANVAS_FULL_AREA {0, 0, CANVAS_SIZE - 1, CANVAS_SIZE - 1}
+
+// Pre-rotated 1 bpp bitmap of a canvas area, kept at the canvas' bit alignment so
+// it can be composed into a canvas with whole-byte operations
+#define CANVAS_SPRITE_SIZE 27
+#define CANVAS_SPRITE_STRIDE DIV_ROUND_UP(CANVAS_SPRITE_SIZE + 7, 8)
+
+struct canvas_sprite {
+    lv_area_t area;
+    uint8_t bits[CANVAS_SPRITE_SIZE][CANVAS_SPRITE_STRIDE];
 };
 
-void rotate_canvas(lv_obj_t *canvas);
+// Digits pre-rendered by LVGL into one 1 bpp strip, plus an optional prefix, for
+// numbers that change while typing. Blitting them skips glyph lookup and label
+// layout. Entries 0-9 are the digits and GLYPH_ATLAS_PREFIX the prefix.
+#define GLYPH_ATLAS_HEIGHT 18
+#define GLYPH_ATLAS_WIDTH 176
+#define GLYPH_ATLAS_PAD 1
+#define GLYPH_ATLAS_PREFIX 10
+#define GLYPH_ATLAS_ENTRIES 11
+
+struct glyph_atlas {
+    // 0 if the font did not fit, in which case blits fall back to LVGL
+    uint8_t height;
+    bool has_prefix;
+    uint8_t advance[GLYPH_ATLAS_ENTRIES];
+    uint8_t column[GLYPH_ATLAS_ENTRIES];
+    uint8_t bits[GLYPH_ATLAS_HEIGHT][GLYPH_ATLAS_WIDTH / 8];
+};
+
+// The charging bolt of the battery indicator, one row per logical row with
+// bit 15 at column 0, placed at (BOLT_X, BOLT_Y) in the top canvas. The fill is
+// foreground; the outline is background, separating the bolt from the bar.
+#define BOLT_X 9
+#define BOLT_Y -1
+#define BOLT_W 11
+#define BOLT_H 18
+
+extern const uint16_t bolt_fill_rows[BOLT_H];
+extern const uint16_t bolt_outline_rows[BOLT_H];
+
+// Width in pixels of the charge bar draw_battery() shows for `level`
+static inline uint8_t battery_bar_width(uint8_t level) { return (level + 2) / 4; }
+
+void canvas_set_buffer(lv_obj_t *canvas, uint8_t *buf);
+lv_obj_t *canvas_scratch_init(lv_obj_t *parent);
+lv_obj_t *canvas_scratch(void);
+void canvas_rotate_area(lv_obj_t *canvas, const lv_area_t *area);
+void canvas_add_mirror(lv_obj_t *canvas, lv_obj_t *mirror);
+void canvas_invalidate_area(lv_obj_t *canvas, const lv_area_t *area);
+void canvas_scratch_clear(const lv_area_t *area);
+void canvas_scratch_polyline(const lv_point_t points[], uint32_t point_cnt,
+                             const lv_area_t *clip);
+void canvas_fill_area(lv_obj_t *canvas, lv_coord_t x, lv_coord_t y, lv_coord_t w, lv_coord_t h,
+                      bool foreground);
+void canvas_clear_area(lv_obj_t *canvas, const lv_area_t *area);
+void canvas_scroll_area(lv_obj_t *canvas, const lv_area_t *area, int32_t dx);
+void canvas_save_pixels(lv_obj_t *canvas, uint8_t *dst);
+void canvas_load_pixels(lv_obj_t *canvas, const uint8_t *src);
+void canvas_pack_sprite(struct canvas_sprite *sprite, const lv_area_t *area);
+void canvas_blit_sprite(lv_obj_t *canvas, const struct canvas_sprite *sprite);
+void glyph_atlas_init(struct glyph_atlas *atlas, const lv_font_t *font, const char *prefix);
+bool canvas_blit_number(lv_obj_t *canvas, const struct glyph_atlas *atlas, lv_coord_t x,
+                        lv_coord_t y, lv_coord_t max_w, lv_text_align_t align, uint32_t value);
+void area_join(lv_area_t *dst, const lv_area_t *src);
+bool area_overlaps(const lv_area_t *a, const lv_area_t *b);
+static inline bool area_is_empty(const lv_area_t *area) {
+    return area->x1 > area->x2 || area->y1 > area->y2;
+}
 void draw_battery(lv_obj_t *canvas, const struct status_state *state);
 void init_label_dsc(lv_draw_label_dsc_t *label_dsc, lv_color_t color, const lv_font_t *font,
                     lv_text_align_t align);
@@ -54,6 +178,8 @@ void init_rect_dsc(lv_draw_rect_dsc_t *rect_dsc, lv_color_t bg_color);
 void init_line_dsc(lv_draw_line_dsc_t *line_dsc, lv_color_t color, uint8_t width);
 void init_arc_dsc(lv_draw_arc_dsc_t *arc_dsc, lv_color_t color, uint8_t width);
 
+void canvas_begin(lv_obj_t *canvas);
+void canvas_finish(lv_obj_t *canvas);
 void canvas_draw_line(lv_obj_t *canvas, const lv_point_t points[], uint32_t point_cnt,
                       lv_draw_line_dsc_t *draw_dsc);
 void canvas_draw_rect(lv_obj_t *canvas, lv_coord_t x, lv_coord_t y, lv_coord_t w, lv_coord_t h,